@@ -7,6 +7,12 @@
  * It provides functions for tile retrieval, neighbor lookup, ownership and color assignment,
  * and overall grid initialization.
  *
+ * Tiles are stored contiguously in axial row order (q = x, r = z), so coordinate
+ * lookups resolve to a flat index through a per-row offset table instead of a hash.
+ * A BoardView mirrors ownership and color as byte arrays for whole-board queries,
+ * and two RegionTrackers keep the connected territories of each owner and color
+ * up to date as tiles change.
+ *
  * The cube coordinate system ensures consistent hex-grid relationships via the constraint:
  * \f$x + y + z = 0\f$.
  *
@@ -22,18 +28,24 @@
 #include "CubeCoord.hpp"
 #include "Tile.hpp"
 #include "Company.hpp"
-#include <unordered_map>
+#include "BoardView.hpp"
+#include "RegionTracker.hpp"
 #include <vector>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 
 /**
  * @class Board
  * @brief Represents a hexagonal game board composed of cube-coordinate tiles.
  *
  * @details
- * The Board is implemented as an unordered map keyed by CubeCoord, enabling
- * constant-time lookup of tiles. Each tile may store its owner (Company) and
- * visual color data. The board supports neighbor detection and manipulation of
- * tile attributes.
+ * The Board stores its tiles in a dense vector ordered row by row along the
+ * axial r axis (cube z), with q (cube x) increasing inside each row. A cube
+ * coordinate maps to its slot as rowOffsets[r + radius] + q, giving constant-time,
+ * hash-free lookup and cache-friendly iteration. Each tile may store its owner
+ * (Company) and visual color data. The board supports neighbor detection and
+ * manipulation of tile attributes.
  *
  * The design is suitable for strategy or simulation games utilizing hex grids.
  */
@@ -48,14 +60,55 @@ public:
      */
     Board(int radius);
 
+    /** @brief Index returned for coordinates that fall outside the board. */
+    static constexpr int INVALID_INDEX = -1;
+
+    /** @brief Number of neighbor slots per hex tile. */
+    static constexpr int NEIGHBOR_COUNT = 6;
+
+    /** @brief Fixed-slot neighbor indices of a single tile, INVALID_INDEX where off-board. */
+    using NeighborSlots = std::array<int, NEIGHBOR_COUNT>;
+
     /** 
-     * @brief Map of cube coordinates to their corresponding Tile instances. 
+     * @brief Dense storage of every Tile on the board, in axial row order.
      *
      * @details
-     * The unordered_map allows efficient random access and modification of tiles.
+     * The tile at index i sits at getCoord(i). Use indexOf() to go the other way.
+     * Prefer the Board setters for writes; if tiles are modified directly, call
+     * resyncView() afterwards so the BoardView stays consistent.
      * @see CubeCoord, Tile
      */
-    std::unordered_map<CubeCoord, Tile, CubeCoordHash> tiles;
+    std::vector<Tile> tiles;
+
+    /**
+     * @brief Returns the number of tiles on the board.
+     * @return Tile count, equal to 3 * radius * (radius + 1) + 1.
+     */
+    std::size_t tileCount() const { return tiles.size(); }
+
+    /**
+     * @brief Returns the board radius.
+     * @return Number of rings from the center tile to the edge.
+     */
+    int getRadius() const { return radius; }
+
+    /**
+     * @brief Converts a cube coordinate into its index in the tile storage.
+     *
+     * @param[in] coord The cube coordinate to locate.
+     * @return Index into tiles, or INVALID_INDEX if the coordinate is off-board
+     *         or does not satisfy \f$x + y + z = 0\f$.
+     * @post Does not modify board state.
+     */
+    int indexOf(const CubeCoord& coord) const;
+
+    /**
+     * @brief Returns the cube coordinate stored at the given tile index.
+     * @param[in] index Index into tiles.
+     * @return The coordinate of that tile.
+     * @pre index < tileCount()
+     */
+    const CubeCoord& getCoord(std::size_t index) const { return coords[index]; }
 
     /**
      * @brief Retrieves a pointer to the tile at the specified cube coordinate.
@@ -67,9 +120,16 @@ public:
      */
     Tile* getTile(const CubeCoord& coord);
 
+    /** @copydoc getTile(const CubeCoord&) */
+    const Tile* getTile(const CubeCoord& coord) const;
+
     /**
      * @brief Returns all valid neighboring coordinates of the specified tile.
      *
+     * @details
+     * @p coord itself need not be on the board: for a coordinate just outside the
+     * edge, the on-board tiles adjacent to it are returned.
+     *
      * @param[in] coord The cube coordinate for which to find adjacent tiles.
      * @return Vector of CubeCoord objects representing neighboring tiles.
      * @post The returned vector contains only coordinates that exist within the board radius.
@@ -77,6 +137,39 @@ public:
      */
     std::vector<CubeCoord> getNeighbors(const CubeCoord& coord) const;
 
+    /**
+     * @brief Returns the precomputed neighbor slots of a tile.
+     *
+     * @details
+     * Slot i holds the tile index reached by stepping in direction i, or
+     * INVALID_INDEX if that step leaves the board. Slots follow the same direction
+     * order on every tile, so opposite neighbors are always three slots apart.
+     *
+     * @param[in] index Index into tiles.
+     * @return Reference to the six neighbor slots; no allocation is performed.
+     * @pre index < tileCount()
+     */
+    const NeighborSlots& getNeighborSlots(std::size_t index) const { return neighborTable[index]; }
+
+    /**
+     * @brief Invokes a callback for every on-board neighbor of a tile.
+     *
+     * @details
+     * Allocation-free alternative to getNeighbors() for hot loops such as flood
+     * fills and scoring passes.
+     *
+     * @tparam Fn Callable accepting the neighbor's tile index as an int.
+     * @param[in] index Index into tiles.
+     * @param[in] fn Callback invoked once per existing neighbor.
+     * @pre index < tileCount()
+     */
+    template <typename Fn>
+    void forEachNeighbor(std::size_t index, Fn&& fn) const {
+        for (int neighbor : neighborTable[index]) {
+            if (neighbor != INVALID_INDEX) fn(neighbor);
+        }
+    }
+
     /**
      * @brief Assigns a company as the owner of a tile at the given coordinates.
      *
@@ -96,13 +189,91 @@ public:
      * @param[in] x Cube X-coordinate.
      * @param[in] y Cube Y-coordinate.
      * @param[in] z Cube Z-coordinate.
-     * @param[in] color String representation of the desired color.
-     * @pre The tile at (x, y, z) must exist and the color string must be valid.
+     * @param[in] color Interned identifier of the desired color.
+     * @pre The tile at (x, y, z) must exist.
      * @post The tile’s color is updated.
-     * @warning Prints an error if the tile does not exist or color is invalid.
-     * @see Colors::isValid()
+     * @warning Prints an error if the tile does not exist.
+     * @see Colors::tryParse()
+     */
+    void setTileColor(int x, int y, int z, ColorId color);
+
+    /**
+     * @brief Assigns an owner to the tile at the given index.
+     * @param[in] index Index into tiles.
+     * @param[in,out] company Pointer to the Company to assign as owner, or nullptr.
+     * @pre index < tileCount()
+     * @post The tile and the BoardView both record the new owner.
+     */
+    void setTileOwner(std::size_t index, Company* company);
+
+    /**
+     * @brief Assigns a color to the tile at the given index.
+     * @param[in] index Index into tiles.
+     * @param[in] color Interned identifier of the desired color.
+     * @pre index < tileCount()
+     * @post The tile and the BoardView both record the new color.
      */
-    void setTileColor(int x, int y, int z, const std::string& color);
+    void setTileColor(std::size_t index, ColorId color);
+
+    /**
+     * @brief Returns the structure-of-arrays mirror of tile owners and colors.
+     * @return Read-only reference to the view, kept in sync by the Board setters.
+     * @see BoardView
+     */
+    const BoardView& getView() const { return view; }
+
+    /**
+     * @brief Rebuilds the BoardView from the Tile objects.
+     * @post getView() matches every tile's owner and color.
+     * @post Region trackers are scheduled for rebuild.
+     * @post Every tile is marked dirty.
+     */
+    void resyncView();
+
+    /**
+     * @brief Returns the tiles whose owner or color changed since clearDirtyTiles().
+     * @details Each index appears at most once. The renderer uses this to redraw only
+     *          changed tiles and to skip frames entirely when nothing changed.
+     * @return Tile indices in the order they were first changed.
+     */
+    const std::vector<int>& getDirtyTiles() const { return dirtyTiles; }
+
+    /** @brief Returns true if any tile changed since clearDirtyTiles(). */
+    bool hasDirtyTiles() const { return !dirtyTiles.empty(); }
+
+    /**
+     * @brief Marks every tile as up to date.
+     * @post getDirtyTiles() is empty.
+     */
+    void clearDirtyTiles();
+
+    /**
+     * @brief Returns the size of the owned territory containing a tile.
+     *
+     * @details
+     * A territory is a connected group of tiles owned by the same company.
+     * Runs in O(α(n)) unless a tile lost or changed owner since the last query,
+     * in which case the owner regions are rebuilt once first.
+     *
+     * @param[in] coord Cube coordinate of the tile.
+     * @return Number of tiles in the territory, 1 for an unowned tile, or 0 if off-board.
+     */
+    std::size_t getTerritorySize(const CubeCoord& coord) const;
+
+    /**
+     * @brief Returns the size of a company's largest contiguous territory.
+     * @param[in] company The owning company.
+     * @return Tile count of its biggest connected region, or 0 if it owns nothing.
+     * @see getTerritorySize()
+     */
+    std::size_t getLargestTerritory(const Company* company) const;
+
+    /**
+     * @brief Returns the size of the largest connected region of one color.
+     * @param[in] color The color to query; Neutral tiles never form regions.
+     * @return Tile count of the biggest connected region of that color.
+     */
+    std::size_t getLargestColorRegion(ColorId color) const;
 
     /**
      * @brief Prints a visual or textual representation of the board.
@@ -118,14 +289,56 @@ private:
     /** @brief The board’s radius, defining its geometric bounds. */
     int radius;
 
+    /** @brief Cube coordinate of each tile, parallel to tiles. */
+    std::vector<CubeCoord> coords;
+
+    /**
+     * @brief Per-row offsets such that a tile's index is rowOffsets[r + radius] + q.
+     *
+     * @details
+     * One entry per axial row (cube z). Each entry already subtracts the row's
+     * minimum q, so lookup needs only an add.
+     */
+    std::vector<int> rowOffsets;
+
+    /** @brief Six neighbor slots per tile, parallel to tiles. Built by generateBoard(). */
+    std::vector<NeighborSlots> neighborTable;
+
+    /** @brief Byte-array mirror of tile owners and colors. */
+    BoardView view;
+
+    /** @brief Nonzero for tiles already listed in dirtyTiles, parallel to tiles. */
+    std::vector<std::uint8_t> tileDirty;
+
+    /** @brief Tiles changed since the last clearDirtyTiles(); bounded by tileCount(). */
+    std::vector<int> dirtyTiles;
+
+    /** @brief Adds a tile to dirtyTiles unless it is already listed. */
+    void markDirty(std::size_t index);
+
+    /** @brief Lists every tile in dirtyTiles. */
+    void markAllDirty();
+
+    /** @brief Connected regions of equally owned tiles, updated on ownership changes. */
+    mutable RegionTracker ownerRegions;
+
+    /** @brief Connected regions of equally colored tiles, updated on color changes. */
+    mutable RegionTracker colorRegions;
+
+    /** @brief Rebuilds any region tracker invalidated by a removal. */
+    void refreshRegions() const;
+
     /**
      * @brief Populates the board with valid cube-coordinate tiles.
      *
      * @details
      * Iterates through cube coordinates satisfying \f$|x|, |y|, |z| \le radius\f$
-     * and inserts corresponding Tile instances into the tile map.
+     * row by row and appends the corresponding Tile instances, recording the
+     * row offsets used by indexOf(). Then resolves every tile's six neighbors
+     * once into neighborTable.
      *
      * @post The board is filled with all valid coordinates for the defined radius.
+     * @post Every tile has its neighbor slots populated.
      */
     void generateBoard();
 };
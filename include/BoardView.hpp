@@ -0,0 +1,175 @@
+/**
+ * @file BoardView.hpp
+ * @brief Declares the BoardView class, a structure-of-arrays mirror of board tile state.
+ *
+ * @details
+ * Tile objects hold a Company pointer and a color each, which is convenient for
+ * single-tile access but scalar and cache-hostile for whole-board queries. The
+ * BoardView keeps the same information as two parallel byte arrays (owner and
+ * color) that Board updates on every write, and provides counting and histogram
+ * kernels written as simple linear loops the compiler can vectorize.
+ *
+ * @see Board, Tile, ColorId
+ *
+ * @date 2025-11-06
+ * @version 1.0
+ * @author
+ * Owen Chilson
+ */
+
+#pragma once
+#include <vector>
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include "ColorId.hpp"
+
+class Board;
+class Company;
+
+/**
+ * @class BoardView
+ * @brief Parallel owner/color byte arrays for fast territory scoring.
+ *
+ * @details
+ * Index i of each array describes the tile at Board::tiles[i]. Owners are
+ * interned into small ids on first sight: id 0 (UNOWNED) always means no
+ * owner, and ids 1..N map back to Company pointers through getCompany().
+ */
+class BoardView {
+public:
+    /** @brief Owner id used for tiles without an owning company. */
+    static constexpr std::uint8_t UNOWNED = 0;
+
+    /** @brief Number of entries in a full byte histogram. */
+    static constexpr std::size_t BYTE_BINS = 256;
+
+    /**
+     * @brief Constructs an empty view; resize() or sync() must be called before use.
+     */
+    BoardView();
+
+    /**
+     * @brief Resets the view to the given size with every tile unowned and Neutral.
+     * @param[in] tileCount Number of tiles on the mirrored board.
+     * @post All owner ids are UNOWNED and all colors are ColorId::Neutral.
+     */
+    void resize(std::size_t tileCount);
+
+    /**
+     * @brief Rebuilds both arrays from the board's Tile objects.
+     * @details Use after mutating Board::tiles directly instead of through Board's setters.
+     * @param[in] board The board to mirror.
+     * @post The view matches every tile's owner and color.
+     */
+    void sync(const Board& board);
+
+    /**
+     * @brief Records a new owner for one tile.
+     * @param[in] index Tile index.
+     * @param[in] company The new owner, or nullptr for unowned.
+     */
+    void setOwner(std::size_t index, const Company* company);
+
+    /**
+     * @brief Records a new color for one tile.
+     * @param[in] index Tile index.
+     * @param[in] color The new color.
+     */
+    void setColor(std::size_t index, ColorId color) { colors[index] = static_cast<std::uint8_t>(color); }
+
+    /**
+     * @brief Returns the interned id of a company, registering it if new.
+     * @param[in] company The company to intern; nullptr maps to UNOWNED.
+     * @return The company's owner id.
+     * @warning At most 255 distinct companies can be interned.
+     */
+    std::uint8_t internOwner(const Company* company);
+
+    /**
+     * @brief Looks up the id of an already interned company.
+     * @param[in] company The company to look up.
+     * @param[out] id Receives the owner id when found.
+     * @return True if the company has been seen by this view.
+     */
+    bool findOwnerId(const Company* company, std::uint8_t& id) const;
+
+    /**
+     * @brief Maps an owner id back to its company.
+     * @param[in] id Owner id.
+     * @return The company, or nullptr for UNOWNED.
+     */
+    const Company* getCompany(std::uint8_t id) const { return owners[id]; }
+
+    /** @brief Number of owner ids in use, including UNOWNED. */
+    std::size_t ownerIdCount() const { return owners.size(); }
+
+    /** @brief Number of tiles mirrored by the view. */
+    std::size_t size() const { return ownerIds.size(); }
+
+    /** @brief Raw owner id array, one byte per tile. */
+    const std::uint8_t* ownerData() const { return ownerIds.data(); }
+
+    /** @brief Raw color array, one byte per tile holding a ColorId. */
+    const std::uint8_t* colorData() const { return colors.data(); }
+
+    /**
+     * @brief Counts tiles owned by a company.
+     * @param[in] company The owner to count; nullptr counts unowned tiles.
+     * @return Number of matching tiles (0 if the company was never seen).
+     */
+    std::size_t countOwnedBy(const Company* company) const;
+
+    /**
+     * @brief Counts tiles of a given color.
+     * @param[in] color The color to count.
+     * @return Number of matching tiles.
+     */
+    std::size_t countColor(ColorId color) const;
+
+    /**
+     * @brief Computes how many tiles each owner id holds.
+     * @param[out] bins Resized to ownerIdCount(); bins[id] receives the tile count.
+     */
+    void ownerHistogram(std::vector<std::uint32_t>& bins) const;
+
+    /**
+     * @brief Computes how many tiles have each color.
+     * @param[out] bins bins[ColorId] receives the tile count.
+     */
+    void colorHistogram(std::array<std::uint32_t, COLOR_COUNT>& bins) const;
+
+    /**
+     * @brief Finds the size of the largest connected region held by one owner.
+     * @details Flood fills over the board's neighbor table, visiting each tile once.
+     * @param[in] board The mirrored board, used for adjacency.
+     * @param[in] ownerId Owner id whose territory is measured.
+     * @return Tile count of the biggest contiguous region, or 0 if none.
+     */
+    std::size_t largestRegion(const Board& board, std::uint8_t ownerId) const;
+
+    /**
+     * @brief Counts the bytes equal to a value.
+     * @details Branch-free accumulation that compilers vectorize into SIMD compares.
+     * @param[in] data Array to scan.
+     * @param[in] count Number of bytes in data.
+     * @param[in] value Value to match.
+     * @return Number of matching bytes.
+     */
+    static std::size_t countEqual(const std::uint8_t* data, std::size_t count, std::uint8_t value);
+
+    /**
+     * @brief Accumulates a full 256-bin histogram of a byte array.
+     * @details Uses four interleaved partial histograms so consecutive equal bytes
+     * do not serialize on the same counter.
+     * @param[in] data Array to scan.
+     * @param[in] count Number of bytes in data.
+     * @param[out] bins Receives BYTE_BINS counts (overwritten, not added to).
+     */
+    static void histogram(const std::uint8_t* data, std::size_t count, std::uint32_t* bins);
+
+private:
+    std::vector<std::uint8_t> ownerIds;     /**< Owner id of each tile. */
+    std::vector<std::uint8_t> colors;       /**< ColorId of each tile. */
+    std::vector<const Company*> owners;     /**< Company for each owner id; entry 0 is nullptr. */
+};
@@ -1,12 +1,15 @@
 /**
  * @file Card.hpp
- * @brief Declares the Card class which represents a singular card and its properties like name and description.
+ * @brief Declares CardDefinition, the shared properties of a card, and Card, a lightweight handle to one copy of it.
  *
  * @details
- * This class manages the individual cards that are loaded in a data driven manner from the cards.json asset. It stores
+ * Card definitions are loaded in a data driven manner from the cards.json asset. A definition stores
  * information such as the cards name and description but additionally and more importantly it handles card trigger events
  * that tie gameplay events to specific actions outlined on the card.
  *
+ * Definitions are immutable and owned by a CardRegistry. Decks, hands and play areas hold Card handles,
+ * which pair a definition with an instance number and are cheap to copy.
+ *
  * @date 2025-11-06
  * @version 1.0
  * @author
@@ -14,28 +17,72 @@
  */
 
 #pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <type_traits>
 #include <vector>
-#include <unordered_map>
 #include <nlohmann/json.hpp>
+#include "Resources.hpp"
+
+class EventSink;
 
 /**
- * @class Card
- * @brief Represents a playable card with triggers and associated actions.
+ * @enum CardTrigger
+ * @brief Gameplay events a card can react to.
  *
- * Each card contains a name, description, and a set of triggers that define
+ * The enumerator order matches the trigger names accepted in cards.json,
+ * so a CardTrigger can index any per-trigger table directly.
+ */
+enum class CardTrigger : std::uint8_t {
+    OnPlay = 0,         ///< "onPlay": fired once when the card is played.
+    OnStartOfDay = 1    ///< "onStartOfDay": fired for every played card at day start.
+};
+
+/** @brief Number of distinct CardTrigger values, usable as a table size. */
+constexpr std::size_t CARD_TRIGGER_COUNT = 2;
+
+/** @brief Interned identifier of a card definition, assigned by CardRegistry in load order. */
+using CardId = std::uint32_t;
+
+/**
+ * @enum CardOp
+ * @brief Operation performed by one compiled card instruction.
+ */
+enum class CardOp : std::uint8_t {
+    AddResource = 0     ///< "addResource": give the player `amount` of `resource`.
+};
+
+/**
+ * @struct CardInstruction
+ * @brief One action from cards.json, decoded once at load time.
+ */
+struct CardInstruction {
+    CardOp op = CardOp::AddResource;    /**< What to do. */
+    int amount = 0;                     /**< Operand quantity. */
+    ResourceId resource = ResourceId::Funds;  /**< Resource the operation applies to, interned at load. */
+};
+
+/**
+ * @class CardDefinition
+ * @brief The immutable properties shared by every copy of a card.
+ *
+ * Each definition contains a name, description, and a set of triggers that define
  * when certain actions occur (e.g., "onPlay", "onStartOfDay").
- * Actions are stored as JSON objects that can be executed dynamically.
+ * Actions are compiled from JSON into typed instructions when the card is loaded,
+ * so firing a trigger never touches JSON or compares action names.
  */
-class Card {
+class CardDefinition {
 public:
+    CardId id = 0;      /**< Registry identifier; set when the definition is registered. */
     std::string name;   /**< The display name of the card. */
     std::string description;  /**< Text description or effect summary. */
 
     /**
-     * @brief Maps trigger event names to a list of action definitions.
+     * @brief Compiled actions for every trigger, stored back to back.
      *
-     * Example format:
+     * Source format:
      * @code
      * {
      *   "onPlay": [
@@ -43,24 +90,126 @@ public:
      *   ]
      * }
      * @endcode
+     * Instructions for trigger t occupy [triggerStart[t], triggerStart[t + 1]).
      */
-    std::unordered_map<std::string, std::vector<nlohmann::json>> triggers;
+    std::vector<CardInstruction> code;
+
+    /** @brief Offset of each trigger's first instruction in code, plus an end sentinel. */
+    std::array<std::uint16_t, CARD_TRIGGER_COUNT + 1> triggerStart{};
 
     /**
-     * @brief Default constructor. Initializes an empty card.
+     * @brief Default constructor. Initializes an empty definition.
      */
-    Card() = default;
+    CardDefinition() = default;
 
     /**
-     * @brief Constructs a card from parsed JSON data.
+     * @brief Constructs a definition from parsed JSON data.
+     *
+     * Unknown trigger names and action types are reported on std::cerr and skipped.
+     *
      * @param data JSON object containing card properties and triggers.
      */
-    Card(const nlohmann::json& data);
+    CardDefinition(const nlohmann::json& data);
 
     /**
      * @brief Executes all actions tied to a given trigger.
-     * @param trigger The trigger event name (e.g. "onPlay").
+     * @param trigger The trigger event.
+     * @param player The player affected by this card’s actions.
+     * @param events Optional sink that receives a ResourceGained event per effect.
+     */
+    void executeTrigger(CardTrigger trigger, class Player& player, EventSink* events = nullptr) const;
+
+    /**
+     * @brief Executes all actions tied to a trigger given by name.
+     * @param trigger The trigger event name (e.g. "onPlay"); unknown names do nothing.
+     * @param player The player affected by this card’s actions.
+     * @param events Optional sink that receives a ResourceGained event per effect.
+     */
+    void executeTrigger(const std::string& trigger, class Player& player, EventSink* events = nullptr) const;
+
+    /**
+     * @brief Checks whether the card has any actions for a trigger.
+     * @param trigger The trigger event.
+     * @return True if firing the trigger would do something.
+     */
+    bool hasTrigger(CardTrigger trigger) const;
+
+    /** @brief Returns the first compiled instruction of a trigger. */
+    const CardInstruction* triggerBegin(CardTrigger trigger) const {
+        return code.data() + triggerStart[static_cast<std::size_t>(trigger)];
+    }
+
+    /** @brief Returns one past the last compiled instruction of a trigger. */
+    const CardInstruction* triggerEnd(CardTrigger trigger) const {
+        return code.data() + triggerStart[static_cast<std::size_t>(trigger) + 1];
+    }
+
+    /**
+     * @brief Parses a trigger name as used in cards.json.
+     * @param[in] name Trigger name (e.g. "onStartOfDay").
+     * @param[out] out Receives the trigger if the name is recognized.
+     * @return True on success.
+     */
+    static bool tryParseTrigger(const std::string& name, CardTrigger& out);
+
+    /**
+     * @brief Returns the cards.json name of a trigger.
+     * @param trigger Trigger to name.
+     * @return Name accepted by tryParseTrigger().
+     */
+    static const char* triggerName(CardTrigger trigger);
+};
+
+/**
+ * @class Card
+ * @brief A handle to one physical copy of a card.
+ *
+ * Holds a pointer to its shared CardDefinition and a per-copy instance number, so
+ * moving a card between decks, hands and play areas copies 16 bytes rather than
+ * its name, description and actions. A default-constructed Card refers to no
+ * definition and is returned when drawing from an empty deck.
+ *
+ * @warning The CardRegistry that owns the definition must outlive every handle to it.
+ */
+class Card {
+public:
+    /** @brief Default constructor. Creates an empty handle. */
+    Card() = default;
+
+    /**
+     * @brief Creates a handle to one copy of a definition.
+     * @param def The shared definition, owned by a CardRegistry.
+     * @param instance Number distinguishing this copy from others of the same definition.
+     */
+    Card(const CardDefinition* def, std::uint32_t instance) : definition(def), instanceId(instance) {}
+
+    /** @brief Returns true if the handle refers to a definition. */
+    bool isValid() const { return definition != nullptr; }
+
+    /** @brief Returns the shared definition, or nullptr for an empty handle. */
+    const CardDefinition* getDefinition() const { return definition; }
+
+    /** @brief Returns the registry identifier of the definition. */
+    CardId getId() const { return definition ? definition->id : 0; }
+
+    /** @brief Returns the number identifying this copy. */
+    std::uint32_t getInstanceId() const { return instanceId; }
+
+    /** @brief Returns the card's display name, or an empty string for an empty handle. */
+    const std::string& getName() const;
+
+    /**
+     * @brief Executes all actions the definition ties to a trigger.
+     * @param trigger The trigger event.
      * @param player The player affected by this card’s actions.
+     * @param events Optional sink that receives a ResourceGained event per effect.
      */
-    void executeTrigger(const std::string& trigger, class Player& player) const;
+    void executeTrigger(CardTrigger trigger, class Player& player, EventSink* events = nullptr) const;
+
+private:
+    const CardDefinition* definition = nullptr;  /**< Shared properties; owned by a CardRegistry. */
+    std::uint32_t instanceId = 0;                /**< Copy number; 0 for an empty handle. */
 };
+
+static_assert(std::is_trivially_copyable<Card>::value,
+              "Card handles must stay trivially copyable so zone transfers never allocate");
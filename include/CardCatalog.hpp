@@ -0,0 +1,73 @@
+/**
+ * @file CardCatalog.hpp
+ * @brief Declares CardCatalog, a process-wide cache of loaded card pools.
+ *
+ * @details
+ * Every game starts from the same card file, and a simulation farm starts thousands of
+ * games at once. A CardCatalog loads a card file once and is then shared read-only by
+ * every game using it: each game fills its draw deck from the catalog's pool, copying
+ * handles instead of reading and parsing the file again.
+ *
+ * Catalogs are cached by resolved path and keyed on the file's size and modification
+ * time, so editing cards.json between games is picked up by the next setup. Games that
+ * are already running keep the catalog they started with alive through their shared_ptr.
+ *
+ * @see Deck::loadCardPool(), GameEngine::setup()
+ *
+ * @date 2025-11-06
+ * @version 1.0
+ * @author
+ * Owen Chilson
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "CardRegistry.hpp"
+#include "CardZone.hpp"
+#include "Deck.hpp"
+
+/**
+ * @class CardCatalog
+ * @brief An immutable card pool loaded once per process and shared between games.
+ */
+class CardCatalog {
+public:
+    /**
+     * @brief Returns the catalog for a card file, loading it on first use or after it changes.
+     * @param[in] filename Card file name, resolved with PathUtils::getAssetPath().
+     * @return The shared catalog; empty if the file could not be read.
+     * @note Thread-safe. Concurrent callers asking for the same file wait for one load.
+     */
+    static std::shared_ptr<const CardCatalog> get(const std::string& filename);
+
+    /** @brief Returns the definitions in the pool. */
+    const CardRegistry& getRegistry() const { return registry; }
+
+    /** @brief Returns the number of cards in the pool, counting every copy. */
+    std::size_t size() const { return pool.size(); }
+
+    /**
+     * @brief Replaces a deck's contents with one handle per card in the pool.
+     * @param[out] deck Deck to fill, in load order and unshuffled.
+     * @post Instance numbers run from 1 to size(), matching a fresh load of the file.
+     */
+    void fillDeck(Deck& deck) const;
+
+    /**
+     * @brief Sizes a hand or play area to hold the whole pool.
+     * @param[in,out] zone Zone to reserve; afterwards, adding cards of this pool never allocates.
+     */
+    void reserveZone(CardZone& zone) const { zone.reserve(copiesById); }
+
+private:
+    /** @brief Loads a card file; use get() instead. */
+    explicit CardCatalog(const std::string& filename);
+
+    CardRegistry registry;      ///< Definitions, never modified after construction.
+    std::vector<CardId> pool;   ///< Definition of each card in the pool, one entry per copy.
+    std::vector<std::uint32_t> copiesById;  ///< Copies of each definition in the pool.
+};
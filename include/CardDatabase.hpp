@@ -0,0 +1,73 @@
+/**
+ * @file CardDatabase.hpp
+ * @brief Declares CardDatabase, a precompiled binary form of cards.json.
+ *
+ * @details
+ * Parsing cards.json through the nlohmann DOM on every setup is pure overhead once the
+ * data is fixed. The spotlight_cardc build step compiles it into a versioned binary table
+ * (cards.bin, under the build directory's assets/) that holds every definition already
+ * lowered to CardInstructions.
+ * Loading maps the file into memory and builds definitions straight from its records,
+ * with no JSON parsing.
+ *
+ * The table records the size and modification time of the JSON it was built from. If
+ * cards.json has changed since, or the table is missing, corrupt or from another format
+ * version, load() fails and callers fall back to the JSON loader.
+ *
+ * File layout (native byte order, all offsets relative to the string blob):
+ * @code
+ * Header | CardRecord[cardCount] | InstructionRecord[instructionCount]
+ *        | ResourceRecord[resourceCount] | char strings[stringBytes]
+ * @endcode
+ *
+ * @see Deck::loadCardPool(), CardDefinition
+ *
+ * @date 2025-11-06
+ * @version 1.0
+ * @author
+ * Owen Chilson
+ */
+
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+#include "CardRegistry.hpp"
+
+/**
+ * @class CardDatabase
+ * @brief Compiles cards.json to a binary table and loads it back.
+ */
+class CardDatabase {
+public:
+    /** @brief Format version; bump whenever the record layout or CardOp meanings change. */
+    static constexpr std::uint32_t VERSION = 1;
+
+    /** @brief One card in the pool and how many copies a deck receives. */
+    struct Entry {
+        const CardDefinition* definition;   ///< Registered definition.
+        int copies;                         ///< Copies to put in the deck.
+    };
+
+    /**
+     * @brief Compiles a JSON card file into a binary table.
+     * @param[in] jsonPath Source cards.json.
+     * @param[in] dbPath Destination file; replaced atomically.
+     * @param[out] error Receives a description on failure.
+     * @return True on success.
+     */
+    static bool compile(const std::filesystem::path& jsonPath, const std::filesystem::path& dbPath,
+                        std::string& error);
+
+    /**
+     * @brief Loads a binary table if it is current.
+     * @param[in] dbPath Binary table to load.
+     * @param[in] jsonPath JSON source the table must match; skipped if the file does not exist.
+     * @param[in,out] registry Registry that receives the definitions; untouched on failure.
+     * @param[out] entries Receives one entry per card, in file order.
+     * @return False if the table is missing, stale, corrupt or of another version.
+     */
+    static bool load(const std::filesystem::path& dbPath, const std::filesystem::path& jsonPath,
+                     CardRegistry& registry, std::vector<Entry>& entries);
+};
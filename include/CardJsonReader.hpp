@@ -0,0 +1,47 @@
+/**
+ * @file CardJsonReader.hpp
+ * @brief Declares CardJsonReader, a streaming reader for card files.
+ *
+ * @details
+ * Card files are a JSON array of card objects. Parsing one with `file >> data` builds the
+ * DOM for every card before the first is compiled, so peak memory grows with the size of
+ * the pool, which matters for generated pools of 100k+ cards. CardJsonReader drives
+ * nlohmann's SAX parser instead and materializes only one card object at a time. That
+ * object is handed to a callback and then discarded.
+ *
+ * @see Deck::loadFromJsonFile(), CardDatabase::compile()
+ *
+ * @date 2025-11-06
+ * @version 1.0
+ * @author
+ * Owen Chilson
+ */
+
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <istream>
+#include <string>
+#include <nlohmann/json.hpp>
+
+/**
+ * @class CardJsonReader
+ * @brief Streams the card objects of a card file one at a time.
+ */
+class CardJsonReader {
+public:
+    /** @brief Receives each card object; the reference is only valid during the call. */
+    using CardCallback = std::function<void(const nlohmann::json& card)>;
+
+    /**
+     * @brief Reads a card file, calling onCard for each element of its top-level array.
+     *
+     * @param[in,out] input Stream positioned at the start of the file.
+     * @param[in] onCard Called once per card, in file order. Exceptions it throws stop the
+     *                   read and are reported as errors.
+     * @param[out] error Receives a description on failure.
+     * @return True if the whole file was read. On failure, cards before the error have
+     *         already been passed to onCard.
+     */
+    static bool read(std::istream& input, const CardCallback& onCard, std::string& error);
+};
@@ -0,0 +1,73 @@
+/**
+ * @file CardRegistry.hpp
+ * @brief Declares the CardRegistry class which owns every card definition used by a game.
+ *
+ * @details
+ * Each distinct card in cards.json is compiled once into a CardDefinition and stored here.
+ * Decks, hands and play areas then refer to definitions through small Card handles, so
+ * twenty copies of "Daily Funding" share one name, description and action list.
+ *
+ * @see CardDefinition, Card, Deck
+ *
+ * @date 2025-11-06
+ * @version 1.0
+ * @author
+ * Owen Chilson
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include "Card.hpp"
+
+/**
+ * @class CardRegistry
+ * @brief Owns card definitions and hands out handles to copies of them.
+ *
+ * Definitions are kept in a deque so their addresses stay stable as more are added,
+ * which keeps every outstanding Card handle valid for the registry's lifetime.
+ */
+class CardRegistry {
+public:
+    /**
+     * @brief Registers a definition, or returns the existing one with the same name.
+     * @param definition Definition to store; its id is assigned here.
+     * @return The registered definition.
+     * @note Definitions are immutable once registered, so a repeated name keeps the first version.
+     * @throws std::length_error If every CardId is already in use.
+     */
+    const CardDefinition& add(CardDefinition definition);
+
+    /**
+     * @brief Looks up a definition by card name.
+     * @param name Card name.
+     * @return The definition, or nullptr if no card has that name.
+     */
+    const CardDefinition* find(const std::string& name) const;
+
+    /**
+     * @brief Retrieves a definition by id.
+     * @param id Identifier assigned by add().
+     * @return The definition.
+     * @pre id < size()
+     */
+    const CardDefinition& get(CardId id) const;
+
+    /**
+     * @brief Creates a handle to a new copy of a definition.
+     * @param definition A definition owned by this registry.
+     * @return A card with a fresh instance number.
+     */
+    Card makeInstance(const CardDefinition& definition);
+
+    /** @brief Returns the number of registered definitions. */
+    std::size_t size() const;
+
+private:
+    std::deque<CardDefinition> definitions;             ///< Definitions indexed by CardId.
+    std::unordered_map<std::string, CardId> idsByName;  ///< Name lookup for commands and loading.
+    std::uint32_t nextInstanceId = 1;                   ///< Next instance number; 0 marks an empty handle.
+};
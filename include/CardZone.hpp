@@ -0,0 +1,92 @@
+/**
+ * @file CardZone.hpp
+ * @brief Declares CardZone, an unordered collection of cards indexed by definition.
+ *
+ * @details
+ * A player's hand and play area are CardZones. Besides the cards themselves, a zone
+ * keeps, for every CardId, the positions of the copies it holds. Finding, taking or
+ * counting a card by id is therefore O(1) regardless of how many cards the zone holds,
+ * and no name strings are compared.
+ *
+ * Removal swaps the last card into the freed slot, so zone order is not preserved.
+ *
+ * @see Card, CardRegistry, Player
+ *
+ * @date 2025-11-06
+ * @version 1.0
+ * @author
+ * Owen Chilson
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Card.hpp"
+
+/**
+ * @class CardZone
+ * @brief A collection of cards with constant-time lookup and removal by CardId.
+ */
+class CardZone {
+public:
+    using const_iterator = std::vector<Card>::const_iterator;
+
+    /**
+     * @brief Adds a card to the zone.
+     * @param card The card, handed over by the caller.
+     * @return The card's new location, valid until the zone next changes.
+     */
+    Card& add(Card&& card);
+
+    /**
+     * @brief Removes one copy of a card and hands it to the caller.
+     * @param id Definition of the card to remove.
+     * @param[out] out Receives the removed card.
+     * @return True if the zone held a copy; false leaves the zone and out untouched.
+     */
+    bool take(CardId id, Card& out);
+
+    /**
+     * @brief Removes every copy of a card.
+     * @param id Definition of the cards to remove.
+     * @return Number of cards removed.
+     */
+    std::size_t removeAll(CardId id);
+
+    /**
+     * @brief Counts the copies of a card in the zone.
+     * @param id Definition to count.
+     * @return Number of copies.
+     */
+    std::size_t count(CardId id) const;
+
+    /** @brief Returns true if the zone holds at least one copy of a card. */
+    bool contains(CardId id) const { return count(id) != 0; }
+
+    /**
+     * @brief Reserves room for every card of a pool so adding any of them never allocates.
+     * @param copiesById Number of copies of each CardId in the pool, indexed by CardId.
+     */
+    void reserve(const std::vector<std::uint32_t>& copiesById);
+
+    /** @brief Returns the number of cards in the zone. */
+    std::size_t size() const { return cards.size(); }
+
+    /** @brief Returns true if the zone holds no cards. */
+    bool empty() const { return cards.empty(); }
+
+    /** @brief Returns the most recently placed card in the last slot. */
+    const Card& back() const { return cards.back(); }
+
+    const_iterator begin() const { return cards.begin(); }
+    const_iterator end() const { return cards.end(); }
+
+private:
+    /** @brief Removes the card at a position by swapping the last card into it. */
+    void eraseAt(std::size_t position);
+
+    std::vector<Card> cards;                            ///< The cards, in no particular order.
+    std::vector<std::uint32_t> bucketSlot;              ///< For each card, its index in positionsById[id].
+    std::vector<std::vector<std::uint32_t>> positionsById;  ///< For each CardId, positions of its copies.
+};
@@ -0,0 +1,41 @@
+/**
+ * @file ColorId.hpp
+ * @brief Defines the compact ColorId enumeration used to store tile colors.
+ *
+ * @details
+ * Tiles and the board carry colors as a one-byte ColorId rather than a string.
+ * Conversion to and from color names happens only at the command and data
+ * boundaries through the Colors class.
+ *
+ * @see Colors, Tile
+ *
+ * @date 2025-11-06
+ * @version 1.0
+ * @author
+ * Owen Chilson
+ */
+
+#pragma once
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @enum ColorId
+ * @brief Interned identifier for each standard color.
+ *
+ * The enumerator order matches Colors::all, so a ColorId can index any
+ * per-color table directly.
+ */
+enum class ColorId : std::uint8_t {
+    Red = 0,
+    Yellow = 1,
+    Blue = 2,
+    Green = 3,
+    Purple = 4,
+    White = 5,
+    Gray = 6,
+    Neutral = 7
+};
+
+/** @brief Number of distinct ColorId values, usable as a table size. */
+constexpr std::size_t COLOR_COUNT = 8;
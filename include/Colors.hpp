@@ -18,14 +18,16 @@
 #include <string>
 #include <algorithm>
 #include <map>
-#include <SFML/Graphics/Color.hpp>
+#include "ColorId.hpp"
 
 /**
  * @class Colors
  * @brief Centralized static utility for color name validation and mapping.
  *
- * Provides a list of all valid color names, their ANSI escape codes for
- * console output, and their corresponding SFML color values for rendering.
+ * Provides a list of all valid color names and their ANSI escape codes for
+ * console output. Names are converted to ColorId once at input boundaries; all
+ * other lookups index flat tables by ColorId. The class has no SFML dependency;
+ * on-screen colors live with the Renderer.
  */
 class Colors {
 public:
@@ -37,12 +39,7 @@ public:
     static const std::map<std::string, std::string> colorCodes;
 
     /**
-     * @brief Maps color names to their SFML color equivalents.
-     */
-    static const std::map<std::string, sf::Color> sfmlColors;
-
-    /**
-     * @brief List of all valid color names.
+     * @brief List of all valid color names, indexed by ColorId.
      */
     static const std::vector<std::string> all;
 
@@ -54,9 +51,18 @@ public:
     static bool isValid(const std::string& color);
 
     /**
-     * @brief Retrieves the SFML color object associated with a color name.
-     * @param color The color name to retrieve.
-     * @return A reference to the matching sf::Color, or the "Neutral" color if not found.
+     * @brief Converts a color name into its ColorId.
+     * @param color The color name to convert.
+     * @param[out] id Receives the matching ColorId when the name is valid.
+     * @return True if the color exists in @ref all, false otherwise (id is left unchanged).
      */
-    static const sf::Color& getSfmlColor(const std::string& color);
+    static bool tryParse(const std::string& color, ColorId& id);
+
+    /**
+     * @brief Retrieves the display name of a color.
+     * @param id The color to name.
+     * @return A reference to the matching entry of @ref all.
+     */
+    static const std::string& toString(ColorId id);
+
 };
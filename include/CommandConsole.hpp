@@ -86,6 +86,15 @@ public:
      */
     bool hasCommand() const { return !pendingCommands.empty(); }
 
+    /**
+     * @brief Returns whether the console's contents changed since it was last drawn.
+     * @details Set by print(), clear() and input handled in handleEvent().
+     */
+    bool isDirty() const { return dirty; }
+
+    /** @brief Marks the console as drawn. */
+    void clearDirty() { dirty = false; }
+
     bool awaitingNextPage = false;  /**< True if more paginated output remains. */
 
 private:
@@ -108,4 +117,6 @@ private:
 
     // Config
     const size_t maxLines = 10;             /**< Maximum number of visible console lines. */
+
+    bool dirty = true;                      /**< True until the current contents have been drawn. */
 };
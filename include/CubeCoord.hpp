@@ -6,6 +6,9 @@
  * This file provides the CubeCoord structure used to represent positions in a
  * 3D cube coordinate system (commonly used for hexagonal grids) and a custom hash
  * functor to enable their use as keys in unordered containers.
+ *
+ * Because x + y + z = 0, the z component is redundant; a coordinate is fully
+ * identified by a packed 64-bit key holding x and y, which is what the hash mixes.
  * 
  * @date 2025-11-06
  * @version 1.0
@@ -15,6 +18,7 @@
 
 #pragma once
 #include <functional>
+#include <cstdint>
 
 /**
  * @struct CubeCoord
@@ -34,7 +38,20 @@ struct CubeCoord {
      * @param y_ The y coordinate.
      * @param z_ The z coordinate.
      */
-    CubeCoord(int x_, int y_, int z_) : x(x_), y(y_), z(z_) {}
+    constexpr CubeCoord(int x_, int y_, int z_) : x(x_), y(y_), z(z_) {}
+
+    /**
+     * @brief Packs the coordinate into a single 64-bit key.
+     *
+     * @details
+     * The high 32 bits hold x and the low 32 bits hold y. z is omitted since it is
+     * implied by x + y + z = 0, so distinct valid coordinates always yield distinct keys.
+     * @return The packed key.
+     */
+    constexpr std::uint64_t packKey() const noexcept {
+        return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) |
+               static_cast<std::uint64_t>(static_cast<std::uint32_t>(y));
+    }
 
     /**
      * @brief Compares two CubeCoords for equality.
@@ -54,12 +71,17 @@ struct CubeCoord {
 /**
  * @struct CubeCoordHash
  * @brief Hash functor for CubeCoord, allowing use in unordered containers.
+ *
+ * @details
+ * Runs the packed key through a 64-bit avalanche mixer so that nearby and
+ * mirror-image coordinates spread evenly across buckets, even with standard
+ * libraries whose std::hash<int> is the identity function.
  */
 struct CubeCoordHash {
     /**
      * @brief Generates a hash for a CubeCoord.
      * @param c The coordinate to hash.
-     * @return The hash value.
+     * @return The mixed hash of c.packKey().
      */
     std::size_t operator()(const CubeCoord& c) const noexcept;
 };
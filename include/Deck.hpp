@@ -3,12 +3,12 @@
  * @brief Declares the Deck class used for managing collections of Card objects.
  *
  * @details
- * The Deck class represents a container of Card instances. It provides
+ * The Deck class represents a container of Card handles. It provides
  * functionality for loading cards from JSON files, shuffling, drawing,
  * transferring cards between decks, and querying deck state.
  *
- * @note This class assumes that the Card type supports construction from JSON objects.
- * @see Card, PathUtils
+ * @note Card definitions are owned by a CardRegistry, which must outlive the deck.
+ * @see Card, CardRegistry, PathUtils
  *
  * @date 2025-11-06
  * @version 1.0
@@ -20,6 +20,8 @@
 #include <vector>
 #include <string>
 #include "Card.hpp"
+#include "CardRegistry.hpp"
+#include "Rng.hpp"
 
 /**
  * @class Deck
@@ -43,25 +45,52 @@ public:
     /** @brief The deck’s name, used for identification or debugging. */
     std::string name;
 
-    /** @brief The internal storage of cards contained within the deck. */
+    /**
+     * @brief The internal storage of cards contained within the deck.
+     * @details Holds 16-byte Card handles; the top of the deck is the back of the vector.
+     */
     std::vector<Card> cards;
 
+    /**
+     * @brief True while the cards are in no random order since the last refill.
+     * @details Set by refillFrom() and cleared by shuffle(); draw() then takes cards at random.
+     */
+    bool unshuffled = false;
+
     /**
      * @brief Loads cards into the deck from a JSON file.
      *
      * @details
      * The JSON file must contain an array of card definitions compatible
-     * with the Card class constructor. Each card may optionally define a
-     * `"copies"` field indicating how many duplicates to create.
+     * with the CardDefinition constructor. Each definition is registered once;
+     * its optional `"copies"` field sets how many handles to it the deck receives.
      *
      * @param[in] filename The name or relative path of the JSON file to load.
+     * @param[in,out] registry Registry that stores the definitions.
      * @pre The file must exist and contain valid JSON.
+     * @return The number of cards now in the deck, or 0 if the file could not be read.
      * @post The deck’s card list is cleared and replaced with the loaded cards.
      * @throws std::exception If JSON parsing fails (caught internally and logged).
      * @warning Logs errors to stderr if the file cannot be found or opened.
-     * @see Card::Card(const nlohmann::json&)
+     * @see CardDefinition::CardDefinition(const nlohmann::json&)
+     */
+    std::size_t loadFromJsonFile(const std::string& filename, CardRegistry& registry);
+
+    /**
+     * @brief Loads the card pool, preferring the precompiled binary database.
+     *
+     * @details
+     * Looks for a table with the same stem and a `.bin` extension beside the JSON file
+     * (assets/cards.bin for cards.json), then in the build tree's generated assets. The
+     * first one built from the current JSON is loaded without parsing any JSON; if none
+     * is, this falls back to loadFromJsonFile().
+     *
+     * @param[in] filename The name or relative path of the JSON file.
+     * @param[in,out] registry Registry that stores the definitions.
+     * @return The number of cards now in the deck, or 0 if neither source could be read.
+     * @see CardDatabase
      */
-    void loadFromJsonFile(const std::string& filename);
+    std::size_t loadCardPool(const std::string& filename, CardRegistry& registry);
 
     /**
      * @brief Adds a card to the deck.
@@ -71,40 +100,109 @@ public:
     void addCard(const Card& card);
 
     /**
-     * @brief Draws the topmost card from the deck.
+     * @brief Adds a card to the deck, taking it from the caller.
+     * @param[in] card The card to be added.
+     * @post The card is appended to the end of the internal vector.
+     */
+    void put(Card&& card);
+
+    /**
+     * @brief Removes the topmost card from the deck and hands it to the caller.
      *
      * @details
-     * Removes the last card from the internal vector (LIFO order) and returns it.
-     * If the deck is empty, an empty Card is returned instead.
+     * Moves the last card out of the internal vector (LIFO order) rather than copying it.
+     * Together with Player::receive() this is the transfer path for drawing.
+     * If the deck is empty, an empty Card handle is returned instead.
      *
      * @pre The deck should contain at least one card.
      * @post The deck’s size decreases by one, unless empty.
-     * @return The drawn Card object.
+     * @return The removed Card.
      * @warning Returns a default-constructed Card if the deck is empty. Reshuffling functionality not implemented.
      */
+    Card take();
+
+    /**
+     * @brief Draws the topmost card from the deck.
+     * @details Equivalent to take(); kept for existing callers.
+     * @return The drawn Card object, or an empty handle if the deck is empty.
+     */
     Card drawCard();
 
     /**
-     * @brief Transfers a card to another deck.
+     * @brief Draws a uniformly random card without shuffling the deck first.
+     *
+     * @details
+     * Performs one step of a Fisher–Yates shuffle: a random card is swapped to the top and
+     * taken. Drawing the whole deck this way yields the same distribution as shuffling then
+     * drawing, but each draw is O(1) and a deck that is only partly drawn is never fully shuffled.
+     *
+     * @param[in,out] gen The random engine to draw from.
+     * @return The drawn Card, or an empty handle if the deck is empty.
+     * @note The order of the remaining cards changes, so do not mix with take() if order matters.
+     */
+    Card takeRandom(Rng& gen);
+
+    /**
+     * @brief Draws the next card, shuffling lazily.
+     *
+     * @details
+     * Takes the top card of a shuffled deck. A deck refilled from the discard pile is
+     * never shuffled as a whole: until the next shuffle() each draw uses takeRandom(), so
+     * cycling a long game's discard pile costs O(1) per card actually drawn.
+     *
+     * @param[in,out] gen The random engine used for random draws.
+     * @return The drawn Card, or an empty handle if the deck is empty.
+     */
+    Card draw(Rng& gen);
+
+    /**
+     * @brief Moves the top card of this deck onto another deck.
      *
-     * @param[in] card The card to move.
      * @param[out] deck The destination deck that receives the card.
-     * @post The specified card is added to the destination deck.
-     * @note This operation does not remove the card from the source deck.
+     * @return True if a card was moved, false if this deck is empty.
+     * @post This deck is one card smaller and the destination one card larger.
      */
-    void moveCardTo(const Card& card, Deck& deck);
+    bool moveCardTo(Deck& deck);
+
+    /**
+     * @brief Moves every card from another deck (typically the discard pile) into this one.
+     *
+     * @details
+     * When this deck is empty, which is the usual case when the draw pile runs out, the two
+     * card buffers are swapped: no cards are copied and nothing is allocated, and the
+     * discard pile keeps this deck's old capacity for reuse. Otherwise the cards are
+     * appended on top of the existing ones, in discard order.
+     *
+     * @param[in,out] discard Deck to empty into this one.
+     * @post @p discard is empty and the whole deck, including any cards it already held, is
+     *       marked unshuffled: draw() picks uniformly from all of it until the next shuffle().
+     */
+    void refillFrom(Deck& discard);
 
     /**
      * @brief Randomly shuffles the order of cards in the deck.
      *
      * @details
-     * Uses a Mersenne Twister pseudo-random generator seeded from std::random_device.
-     * Suitable for gameplay randomness but not cryptographically secure.
+     * Uses a per-thread Mersenne Twister seeded once from std::random_device.
+     * Suitable for gameplay randomness but not cryptographically secure; games
+     * should prefer the overload taking their own Rng so runs can be replayed.
      *
      * @post All cards remain present, but in randomized order.
      */
     void shuffle();
 
+    /**
+     * @brief Shuffles the deck using a caller-owned generator.
+     *
+     * @details
+     * Lets a game drive all of its randomness from one seeded engine so that
+     * runs are reproducible.
+     *
+     * @param[in,out] gen The random engine to draw from.
+     * @post All cards remain present, but in randomized order.
+     */
+    void shuffle(Rng& gen);
+
     /**
      * @brief Gets the number of cards currently in the deck.
      * @return The count of cards.
@@ -0,0 +1,182 @@
+/**
+ * @file EventSink.hpp
+ * @brief Declares typed game events and the EventSink that records and distributes them.
+ *
+ * @details
+ * Gameplay code reports what happened (a card was played, a resource was gained, a
+ * stage was built) as small GameEvent records rather than formatted text. An EventSink
+ * keeps the most recent events in a fixed-size ring buffer and forwards each one to
+ * subscribers (the console, stdout, a log file) whose verbosity admits it.
+ *
+ * When no subscriber wants an event, emit() returns after a single comparison, so
+ * headless simulations pay nothing for logging they have turned off.
+ *
+ * @see GameEngine, CardDefinition::executeTrigger()
+ *
+ * @date 2025-11-06
+ * @version 1.0
+ * @author
+ * Owen Chilson
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "Card.hpp"
+#include "ColorId.hpp"
+#include "CubeCoord.hpp"
+#include "Resources.hpp"
+
+class Player;
+
+/**
+ * @enum EventVerbosity
+ * @brief How much detail a subscriber wants; each event type has a fixed level.
+ */
+enum class EventVerbosity : std::uint8_t {
+    Off = 0,        ///< Nothing.
+    Summary = 1,    ///< Turn-level actions: cards played, stages built, daily income.
+    Detail = 2      ///< Everything, including each card effect and draw.
+};
+
+/**
+ * @enum GameEventType
+ * @brief Kinds of gameplay event.
+ */
+enum class GameEventType : std::uint8_t {
+    ResourceGained, ///< A card effect gave a player resources (Detail).
+    DailyIncome,    ///< A player's summed start-of-day card income (Summary).
+    CardDrawn,      ///< A player drew a card (Detail).
+    CardPlayed,     ///< A player put a card into play (Summary).
+    TileBuilt       ///< A player built a stage on a tile (Summary).
+};
+
+/**
+ * @struct GameEvent
+ * @brief One gameplay event; fields not used by the event type are left at their defaults.
+ *
+ * Players and cards are referenced by pointer, so recording an event never allocates.
+ */
+struct GameEvent {
+    GameEventType type = GameEventType::ResourceGained;  ///< What happened.
+    CardTrigger trigger = CardTrigger::OnPlay;           ///< Trigger that caused a ResourceGained.
+    ResourceId resource = ResourceId::Funds;             ///< Resource gained.
+    ColorId color = ColorId::Neutral;                    ///< Color of a built stage.
+    int amount = 0;                                      ///< Quantity gained.
+    const Player* player = nullptr;                      ///< Player the event is about.
+    const CardDefinition* card = nullptr;                ///< Card drawn, played, or causing the gain.
+    CubeCoord tile{0, 0, 0};                             ///< Tile built on.
+
+    /** @brief Returns the verbosity at which events of this type are reported. */
+    EventVerbosity verbosity() const;
+};
+
+/**
+ * @class EventSink
+ * @brief Records recent game events and forwards them to subscribers.
+ */
+class EventSink {
+public:
+    /** @brief Callback invoked for each event a subscriber admits. */
+    using Subscriber = std::function<void(const GameEvent&)>;
+
+    /** @brief Number of recent events kept for inspection. */
+    static constexpr std::size_t HISTORY_CAPACITY = 256;
+
+    /**
+     * @brief Reports an event.
+     * @details Returns immediately unless some subscriber's verbosity admits the event.
+     * @param event The event.
+     */
+    void emit(const GameEvent& event) {
+        if (event.verbosity() <= maxVerbosity)
+            record(event);
+    }
+
+    /**
+     * @brief Checks whether events of a given verbosity would be delivered anywhere.
+     * @details Lets callers skip building an event entirely.
+     */
+    bool wants(EventVerbosity verbosity) const { return verbosity <= maxVerbosity && verbosity != EventVerbosity::Off; }
+
+    /**
+     * @brief Adds a subscriber.
+     * @param verbosity Most detailed level the subscriber receives.
+     * @param subscriber Callback for each admitted event.
+     * @return Handle for setVerbosity() and unsubscribe().
+     */
+    int subscribe(EventVerbosity verbosity, Subscriber subscriber);
+
+    /**
+     * @brief Adds a subscriber that writes one line per event to a stream.
+     * @param out Destination, e.g. std::cout or an open std::ofstream; must outlive the subscription.
+     * @param verbosity Most detailed level written.
+     * @return Handle for setVerbosity() and unsubscribe().
+     */
+    int subscribeStream(std::ostream& out, EventVerbosity verbosity);
+
+    /**
+     * @brief Changes how much a subscriber receives.
+     * @param handle Value returned by subscribe().
+     * @param verbosity New level; Off silences it without removing it.
+     */
+    void setVerbosity(int handle, EventVerbosity verbosity);
+
+    /**
+     * @brief Removes a subscriber.
+     * @param handle Value returned by subscribe().
+     */
+    void unsubscribe(int handle);
+
+    /**
+     * @brief Returns recorded events, oldest first.
+     * @return Up to HISTORY_CAPACITY of the most recent delivered events.
+     */
+    std::vector<GameEvent> recent() const;
+
+    /**
+     * @brief Formats an event as a line of game text.
+     * @param event The event.
+     * @return Human-readable description without a trailing newline.
+     */
+    static std::string describe(const GameEvent& event);
+
+    /**
+     * @brief Parses a verbosity name ("off", "summary" or "detail").
+     * @param[in] name Name to parse.
+     * @param[out] out Receives the verbosity if the name is recognized.
+     * @return True on success.
+     */
+    static bool tryParseVerbosity(const std::string& name, EventVerbosity& out);
+
+    /**
+     * @brief Returns the canonical name of a verbosity.
+     * @param[in] verbosity Verbosity to name.
+     * @return Name accepted by tryParseVerbosity().
+     */
+    static const char* verbosityName(EventVerbosity verbosity);
+
+private:
+    /** @brief A registered callback and its level. */
+    struct Subscription {
+        int handle;                 ///< Identifier returned to the caller.
+        EventVerbosity verbosity;   ///< Most detailed level delivered.
+        Subscriber callback;        ///< Receiver.
+    };
+
+    /** @brief Stores an admitted event in the ring and delivers it. */
+    void record(const GameEvent& event);
+
+    /** @brief Recomputes maxVerbosity after subscriptions change. */
+    void refreshMaxVerbosity();
+
+    EventVerbosity maxVerbosity = EventVerbosity::Off;  ///< Highest level any subscriber wants.
+    std::vector<Subscription> subscriptions;            ///< Active subscribers.
+    std::vector<GameEvent> history;                     ///< Ring buffer, allocated on first event.
+    std::size_t historyNext = 0;                        ///< Ring slot written next.
+    int nextHandle = 1;                                 ///< Next subscription handle.
+};
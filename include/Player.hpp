@@ -12,11 +12,16 @@
  */
 
 #pragma once
+#include <array>
 #include <string>
 #include <vector>
 #include <unordered_map>
 #include "Company.hpp"
 #include "Card.hpp"
+#include "CardZone.hpp"
+#include "Resources.hpp"
+
+class Deck;
 
 /**
  * @class Player
@@ -33,14 +38,17 @@ public:
     /** @brief Current score value. */
     int score = 0;
 
-    /** @brief Map of resource type to quantity (e.g., "funds", "gear"). */
-    std::unordered_map<std::string, int> resources;
+    /** @brief Quantities of the standard resources, indexed by ResourceId. */
+    std::array<int, KNOWN_RESOURCE_COUNT> knownResources{};
+
+    /** @brief Quantities of any other resources the player has received. */
+    std::unordered_map<ResourceId, int> extraResources;
 
-    /** @brief Cards currently held in hand. */
-    std::vector<Card> heldCards;
+    /** @brief Cards currently held in hand, indexed by CardId. */
+    CardZone heldCards;
 
-    /** @brief Cards that have been played. */
-    std::vector<Card> playedCards;
+    /** @brief Cards that have been played, indexed by CardId. */
+    CardZone playedCards;
 
     /**
      * @brief Constructs a new Player.
@@ -51,13 +59,28 @@ public:
 
     /**
      * @brief Adds a specified amount of a resource type.
-     * @param type The resource key.
+     * @param type The resource id.
+     * @param amount The quantity to add.
+     */
+    void addResource(ResourceId type, int amount);
+
+    /**
+     * @brief Adds a specified amount of a resource type given by name.
+     * @param type The resource key; new names are interned.
      * @param amount The quantity to add.
      */
     void addResource(const std::string& type, int amount);
 
     /**
      * @brief Attempts to spend a specified amount of a resource.
+     * @param type The resource id.
+     * @param amount The quantity to spend.
+     * @return True if the player had enough resources; false otherwise.
+     */
+    bool spendResource(ResourceId type, int amount);
+
+    /**
+     * @brief Attempts to spend a specified amount of a resource given by name.
      * @param type The resource key.
      * @param amount The quantity to spend.
      * @return True if the player had enough resources; false otherwise.
@@ -66,37 +89,74 @@ public:
 
     /**
      * @brief Retrieves the current amount of a resource.
+     * @param type The resource id.
+     * @return The quantity of the specified resource.
+     */
+    int getResource(ResourceId type) const;
+
+    /**
+     * @brief Retrieves the current amount of a resource given by name.
      * @param type The resource key.
      * @return The quantity of the specified resource.
      */
     int getResource(const std::string& type) const;
 
     /**
-     * @brief Adds a card to the player’s hand.
-     * @param card The card to add.
+     * @brief Calls fn(ResourceId, int) for every resource the player has.
+     * @details Visits the standard resources in ResourceId order, then any others.
+     */
+    template <typename Fn>
+    void forEachResource(Fn&& fn) const {
+        for (std::size_t i = 0; i < KNOWN_RESOURCE_COUNT; ++i)
+            fn(static_cast<ResourceId>(i), knownResources[i]);
+        for (const auto& [type, amount] : extraResources)
+            fn(type, amount);
+    }
+
+    /**
+     * @brief Adds a copy of a card to the player’s hand.
+     * @param card The card to add; empty handles are ignored.
      */
     void addHeldCard(const Card& card);
 
+    /**
+     * @brief Takes ownership of a card and places it in the player’s hand.
+     * @details Pairs with Deck::take() to move a card from a deck without copying it.
+     * @param card The card to add; empty handles are ignored.
+     */
+    void receive(Card&& card);
+
+    /**
+     * @brief Relocates one copy of a card from hand to played cards.
+     * @details The card is moved, not copied, and keeps its instance identity. O(1).
+     * @param cardId The definition of the card to play.
+     * @return The card now in play, or nullptr if it was not in hand.
+     * @warning The pointer is invalidated by the next change to playedCards.
+     */
+    Card* playFromHand(CardId cardId);
+
     /**
      * @brief Moves a card from hand to played cards.
-     * @param cardName The name of the card to play.
+     * @param cardId The definition of the card to play.
      * @return True if the card was found and played; false otherwise.
      */
-    bool playCard(const std::string& cardName);
+    bool playCard(CardId cardId);
 
     /**
-     * @brief Removes a played card by name.
-     * @param cardName The name of the card to remove.
+     * @brief Removes every played copy of a card.
+     * @param cardId The definition of the card to remove.
+     * @param discard Deck that receives the removed copies, or nullptr to destroy them.
      * @return True if a card was removed; false otherwise.
      */
-    bool removePlayedCard(const std::string& cardName);
+    bool removePlayedCard(CardId cardId, Deck* discard = nullptr);
 
     /**
-     * @brief Removes a held card by name.
-     * @param cardName The name of the card to remove.
+     * @brief Removes every held copy of a card.
+     * @param cardId The definition of the card to remove.
+     * @param discard Deck that receives the removed copies, or nullptr to destroy them.
      * @return True if a card was removed; false otherwise.
      */
-    bool removeHeldCard(const std::string& cardName);
+    bool removeHeldCard(CardId cardId, Deck* discard = nullptr);
 
     /**
      * @brief Increases the player’s score by a specified amount.
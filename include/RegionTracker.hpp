@@ -0,0 +1,115 @@
+/**
+ * @file RegionTracker.hpp
+ * @brief Declares the RegionTracker class which maintains connected regions of equally labeled tiles.
+ *
+ * @details
+ * A RegionTracker watches one byte label per tile (such as BoardView owner ids or
+ * colors) and keeps the connected components of equal labels in a union-find forest.
+ * Adding a label to a previously ignored tile merges it with its neighbors in
+ * near-constant time. Changing or clearing an existing label can split a region,
+ * which union-find cannot undo, so the tracker marks itself dirty and is rebuilt
+ * from the labels before the next query.
+ *
+ * @see Board, BoardView
+ *
+ * @date 2025-11-06
+ * @version 1.0
+ * @author
+ * Owen Chilson
+ */
+
+#pragma once
+#include <vector>
+#include <array>
+#include <cstdint>
+#include <cstddef>
+
+class Board;
+
+/**
+ * @class RegionTracker
+ * @brief Incremental union-find over board tiles grouped by a byte label.
+ *
+ * @details
+ * Tiles carrying the ignored label (unowned, Neutral, ...) never join a region and
+ * always remain singleton roots. For every other label the tracker records the size
+ * of each region and the largest region seen, so region queries cost O(α(n)).
+ */
+class RegionTracker {
+public:
+    /**
+     * @brief Constructs an empty tracker.
+     * @param[in] ignoredLabel Label value that does not form regions.
+     */
+    explicit RegionTracker(std::uint8_t ignoredLabel);
+
+    /**
+     * @brief Rebuilds every region from scratch.
+     * @param[in] board Board providing tile adjacency.
+     * @param[in] labels One label per tile, parallel to Board::tiles.
+     * @post needsRebuild() is false and all queries reflect labels.
+     */
+    void rebuild(const Board& board, const std::uint8_t* labels);
+
+    /**
+     * @brief Updates regions after one tile's label changed.
+     *
+     * @details
+     * If the tile previously had the ignored label it is merged into the regions of
+     * its equally labeled neighbors immediately. Any other change may split a region,
+     * so the tracker is only marked for rebuild.
+     *
+     * @param[in] board Board providing tile adjacency.
+     * @param[in] labels Labels after the change.
+     * @param[in] index Index of the tile that changed.
+     * @param[in] oldLabel The tile's label before the change.
+     */
+    void onLabelChanged(const Board& board, const std::uint8_t* labels, std::size_t index, std::uint8_t oldLabel);
+
+    /**
+     * @brief Reports whether a removal has invalidated the regions.
+     * @return True if rebuild() must run before the next query.
+     */
+    bool needsRebuild() const { return dirty; }
+
+    /** @brief Marks the regions stale, e.g. after labels were rewritten in bulk. */
+    void invalidate() { dirty = true; }
+
+    /**
+     * @brief Returns the size of the region containing a tile.
+     * @param[in] index Tile index.
+     * @return Number of tiles in the region, or 1 for a tile with the ignored label.
+     * @pre needsRebuild() is false.
+     */
+    std::size_t regionSize(std::size_t index);
+
+    /**
+     * @brief Checks whether two tiles belong to the same region.
+     * @param[in] a First tile index.
+     * @param[in] b Second tile index.
+     * @return True if both tiles are in one connected region.
+     * @pre needsRebuild() is false.
+     */
+    bool sameRegion(std::size_t a, std::size_t b);
+
+    /**
+     * @brief Returns the size of the largest region with a given label.
+     * @param[in] label Label to query.
+     * @return Tile count of that label's largest region, or 0 if it has none.
+     * @pre needsRebuild() is false.
+     */
+    std::size_t largestRegion(std::uint8_t label) const { return largest[label]; }
+
+private:
+    /** @brief Finds a tile's root with path halving. */
+    int find(int index);
+
+    /** @brief Merges the regions of two tiles that share a label. */
+    void unite(int a, int b, std::uint8_t label);
+
+    std::vector<int> parent;                /**< Union-find parent of each tile. */
+    std::vector<std::uint32_t> sizes;       /**< Region size, valid at roots. */
+    std::array<std::uint32_t, 256> largest; /**< Largest region size per label. */
+    std::uint8_t ignoredLabel;              /**< Label that never forms regions. */
+    bool dirty = true;                      /**< True until rebuilt after a removal. */
+};
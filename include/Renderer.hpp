@@ -4,6 +4,15 @@
  *
  * @details
  * Handles visual updates of the board, tiles, and console interface within the main SFML window.
+ * The board is retained between frames: its hexes are tessellated once into a single
+ * vertex array, and only the tiles the Board reports as dirty are patched. The drawn
+ * board is cached in a render texture, so frames caused only by console input
+ * composite that texture instead of redrawing the board. When neither the board nor
+ * the console changed, no frame is drawn at all.
+ *
+ * The board is seen through a camera (an sf::View) that the mouse pans and zooms. Only
+ * the rows of hexes inside the camera are drawn, and labels are dropped once they would
+ * be too small to read, so very large boards stay interactive.
  * 
  * @date 2025-11-06
  * @version 1.0
@@ -13,7 +22,12 @@
 
 #pragma once
 #include <SFML/Graphics.hpp>
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
 #include "Board.hpp"
+#include "TextBatch.hpp"
 #include "Tile.hpp"
 
 class CommandConsole;
@@ -35,28 +49,137 @@ public:
 
     /**
      * @brief Processes SFML window events and forwards input to the console.
+     * @details The mouse wheel zooms around the cursor, dragging with the right or middle
+     *          button pans, and Home resets the camera.
      * @param window The render window to poll for events.
      * @param console Reference to the CommandConsole for input handling.
+     * @param block If true, sleeps until at least one event arrives instead of returning at once.
      */
-    void handleEvents(sf::RenderWindow& window, CommandConsole& console);
+    void handleEvents(sf::RenderWindow& window, CommandConsole& console, bool block = false);
+
+    /**
+     * @brief Returns whether anything on screen is out of date.
+     * @details True when a tile or the console changed, or the window needs repainting
+     *          after being resized or refocused.
+     * @param console The console drawn over the board.
+     */
+    bool needsRender(const CommandConsole& console) const;
 
     /**
      * @brief Draws all visible elements, including the board and console.
+     * @details The board is drawn into a cached layer only when a tile changed; each frame
+     *          then composites that layer with the console. Clears the board's and
+     *          console's dirty flags.
      * @param window The render window where graphics are drawn.
      * @param console Reference to the console for on-screen text rendering.
      */
     void render(sf::RenderWindow& window, CommandConsole& console);
 
+    /**
+     * @brief Retrieves the on-screen fill color for a tile color.
+     * @param id The tile color.
+     * @return A reference to the matching sf::Color.
+     */
+    static const sf::Color& getTileColor(ColorId id);
+
 private:
     /**
      * @brief Renders all hex tiles on the board, their colors, owners, and coordinates.
-     * @param window The render window used for drawing.
+     * @details Draws every hex with a single call on the cached mesh.
+     * @param target The window or board layer to draw into.
+     */
+    void drawBoard(sf::RenderTarget& target);
+
+    /**
+     * @brief Applies camera input from one window event.
+     * @param window The window that produced the event, used to map pixels to the board.
+     * @param event The event to inspect.
+     */
+    void handleCameraEvent(const sf::RenderWindow& window, const sf::Event& event);
+
+    /**
+     * @brief Zooms the camera while keeping the board point under a pixel fixed.
+     * @param window The window the pixel belongs to.
+     * @param pixel Window pixel to zoom around.
+     * @param factor Multiplier for the camera's zoom level; above 1 zooms out.
+     */
+    void zoomCamera(const sf::RenderWindow& window, const sf::Vector2i& pixel, float factor);
+
+    /**
+     * @brief Resets the camera to the window's default view.
+     * @param window The window whose default view to copy.
+     */
+    void resetCamera(const sf::RenderWindow& window);
+
+    /**
+     * @brief Finds the runs of tiles inside a view.
+     * @details Tiles are stored row by row, so the visible tiles of each row form one
+     *          index range; ranges that touch are merged. Fills visibleSpans.
+     * @param view The view the board is about to be drawn with.
      */
-    void drawBoard(sf::RenderWindow& window);
+    void collectVisibleSpans(const sf::View& view);
+
+    /**
+     * @brief Makes sure the board layer exists and matches the window's logical size.
+     * @param window The window the layer is composited into.
+     * @return False if render textures are unavailable, in which case the board is drawn
+     *         straight into the window.
+     */
+    bool ensureBoardLayer(const sf::RenderWindow& window);
+
+    /**
+     * @brief Tessellates every tile into hexMesh and lays out its coordinate label.
+     * @details Runs once per board; afterwards only colors and owner symbols are updated.
+     */
+    void buildBoardMesh();
+
+    /**
+     * @brief Brings the cached mesh and symbols up to date with the board.
+     * @details Rewrites only the tiles in Board::getDirtyTiles(), then clears that list.
+     */
+    void updateBoardMesh();
+
+    /**
+     * @brief Copies one tile's color into the cached mesh and notes owner changes.
+     * @param index Tile index.
+     */
+    void updateTile(std::size_t index);
+
+    /**
+     * @brief Rebuilds symbolBatch from the owner of every tile.
+     * @details Each company's symbol is laid out once and cached in symbolGlyphs; owned
+     *          tiles only copy those vertices into place.
+     */
+    void rebuildSymbols();
 
     /** @brief Reference to the game board instance being rendered. */
     Board& board;
 
     /** @brief Font used for rendering symbols and coordinate labels. */
     sf::Font& font;
+
+    sf::VertexArray hexMesh{sf::Triangles};     ///< Six triangles per tile, in tile index order.
+    std::vector<sf::Vector2f> tileCenters;       ///< Screen position of each tile's center.
+    std::vector<std::uint8_t> meshOwners;        ///< BoardView owner id last shown on each tile.
+    TextBatch coordBatch;                        ///< Coordinate labels of every tile, laid out once.
+    TextBatch symbolBatch;                       ///< Owner symbols of every owned tile.
+    std::vector<std::size_t> coordStart;         ///< First coordBatch vertex of each tile, plus the end.
+    std::vector<std::size_t> symbolStart;        ///< First symbolBatch vertex of each tile, plus the end.
+    std::vector<std::vector<sf::Vertex>> symbolGlyphs; ///< Laid-out symbol of each BoardView owner id.
+    bool symbolsDirty = true;                    ///< Set when a tile's owner changed since rebuildSymbols().
+    bool windowInvalid = true;                   ///< Set when the whole window must be repainted.
+
+    sf::RenderTexture boardLayer;                ///< Last drawn board, composited under the console.
+    bool boardLayerDirty = true;                 ///< Set when boardLayer must be redrawn.
+    bool boardLayerSupported = true;             ///< Cleared if boardLayer cannot be created.
+
+    sf::View camera;                             ///< Part of the board shown in the window.
+    bool cameraReady = false;                    ///< Set once camera has been reset to the window.
+    float zoomLevel = 1.f;                       ///< Camera size relative to the default view.
+    bool dragging = false;                       ///< True while a pan drag is in progress.
+    sf::Vector2i dragPixel;                      ///< Window pixel of the last drag position.
+    std::vector<std::pair<std::size_t, std::size_t>> visibleSpans; ///< Visible tile index ranges [first, last).
+
+    /** @brief SFML fill colors for tiles, indexed by ColorId. */
+    static const std::array<sf::Color, COLOR_COUNT> tileColors;
 };
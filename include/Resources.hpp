@@ -0,0 +1,79 @@
+/**
+ * @file Resources.hpp
+ * @brief Defines ResourceId and the Resources registry that interns resource names.
+ *
+ * @details
+ * Players, cards and commands refer to resources by a small integer ResourceId.
+ * The four standard resources have fixed ids so they can index flat arrays;
+ * any other name (e.g. one introduced by a card) is interned on first use and
+ * receives the next free id. Names are converted only at the command and data
+ * boundaries, mirroring how ColorId is handled.
+ *
+ * @see Player, CardInstruction
+ *
+ * @date 2025-11-06
+ * @version 1.0
+ * @author
+ * Owen Chilson
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @enum ResourceId
+ * @brief Interned identifier for a resource type.
+ *
+ * The named enumerators are the standard resources every player starts with.
+ * Ids from KNOWN_RESOURCE_COUNT upward are handed out by Resources::intern().
+ */
+enum class ResourceId : std::uint16_t {
+    Talent = 0,
+    Staff = 1,
+    Gear = 2,
+    Funds = 3
+};
+
+/** @brief Number of standard resources, usable as a table size. */
+constexpr std::size_t KNOWN_RESOURCE_COUNT = 4;
+
+/**
+ * @class Resources
+ * @brief Process-wide, thread-safe registry of resource names.
+ *
+ * Lookups of the standard names never lock. Interning a new name takes a mutex,
+ * which only happens while cards are compiled or commands are parsed.
+ */
+class Resources {
+public:
+    /**
+     * @brief Resolves a name to its id, registering it if it is new.
+     * @param name The resource name (e.g. "funds").
+     * @return The resource's id.
+     */
+    static ResourceId intern(const std::string& name);
+
+    /**
+     * @brief Resolves a name to its id without registering it.
+     * @param name The resource name.
+     * @param[out] id Receives the id when the name is known.
+     * @return True if the name has been registered, false otherwise (id is left unchanged).
+     */
+    static bool tryParse(const std::string& name, ResourceId& id);
+
+    /**
+     * @brief Retrieves the name of a resource.
+     * @param id An id returned by intern() or tryParse().
+     * @return The registered name; the reference stays valid for the program's lifetime.
+     */
+    static const std::string& toString(ResourceId id);
+
+    /**
+     * @brief Checks whether an id is one of the standard resources.
+     * @param id The id to check.
+     * @return True if the id indexes the fixed per-player resource array.
+     */
+    static bool isKnown(ResourceId id) { return static_cast<std::size_t>(id) < KNOWN_RESOURCE_COUNT; }
+};
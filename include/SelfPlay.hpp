@@ -0,0 +1,148 @@
+/**
+ * @file SelfPlay.hpp
+ * @brief Declares headless self-play games and the statistics aggregated across batches of them.
+ *
+ * @details
+ * SelfPlayGame drives a GameEngine with a simple automated policy so complete games
+ * can be played without a window or user input. Each game is fully determined by its
+ * seed. SimStats accumulates per-company and per-card outcomes across many games and
+ * can be merged, so parallel workers keep private tallies and combine them at the end.
+ *
+ * @see GameEngine, ThreadPool
+ *
+ * @date 2025-11-06
+ * @version 1.0
+ * @author
+ * Owen Chilson
+ */
+
+#pragma once
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "GameEngine.hpp"
+
+/**
+ * @struct SelfPlayConfig
+ * @brief Parameters shared by every game in a simulation batch.
+ */
+struct SelfPlayConfig {
+    int playerCount = 4;        ///< Number of automated players (2-6 in normal play).
+    int boardRadius = 5;        ///< Hex board radius.
+    int days = 20;              ///< Full rounds played before scoring.
+    int buildCost = 3;          ///< Funds spent per stage built.
+    RngEngine engine = RngEngine::Xoshiro256; ///< Random engine used by every game.
+};
+
+/**
+ * @struct PlayerOutcome
+ * @brief Final state of one player at the end of a self-play game.
+ */
+struct PlayerOutcome {
+    std::string company;                    ///< Company name, used as the aggregation key.
+    std::size_t largestTerritory = 0;       ///< Size of the biggest connected owned region.
+    std::size_t tilesOwned = 0;             ///< Total tiles owned.
+    std::map<std::string, int> resources;   ///< Resource totals at game end.
+    std::vector<std::string> cardsPlayed;   ///< Names of every card played, with repeats.
+};
+
+/**
+ * @struct GameOutcome
+ * @brief Result of a single self-play game.
+ */
+struct GameOutcome {
+    std::uint64_t seed = 0;                 ///< Seed that reproduces this game.
+    int winner = -1;                        ///< Index of the winning player.
+    std::vector<PlayerOutcome> players;     ///< Per-player final state, in turn order.
+};
+
+/**
+ * @class SelfPlayGame
+ * @brief A GameEngine played to completion by an automated policy.
+ *
+ * @details
+ * Each turn the active player draws one card, plays every card in hand, then spends
+ * funds building stages, preferring tiles adjacent to its own territory. The winner is
+ * the player with the largest connected territory, breaking ties by tiles owned, then funds.
+ */
+class SelfPlayGame : public GameEngine {
+public:
+    /**
+     * @brief Creates a quiet, seeded game with generated players and companies.
+     * @param[in] config Batch parameters.
+     * @param[in] seed Seed for every random decision in the game.
+     */
+    SelfPlayGame(const SelfPlayConfig& config, std::uint64_t seed);
+
+    /**
+     * @brief Sets up the game and plays it to the end.
+     * @return Final scores and the cards each player played.
+     */
+    GameOutcome play();
+
+private:
+    /** @brief Performs one automated turn for the given player. */
+    void takeTurn(int playerIndex);
+
+    /** @brief Chooses the tile index a player builds on next. */
+    std::size_t chooseBuildTile(const Company* company);
+
+    SelfPlayConfig config;                          ///< Batch parameters.
+    std::uint64_t seed;                             ///< Seed passed to the engine.
+    std::vector<std::vector<std::string>> played;   ///< Cards played per player.
+};
+
+/**
+ * @class SimStats
+ * @brief Aggregated win and resource statistics across many self-play games.
+ */
+class SimStats {
+public:
+    /**
+     * @brief Adds one game's outcome to the totals.
+     * @param[in] outcome The finished game.
+     */
+    void add(const GameOutcome& outcome);
+
+    /**
+     * @brief Folds another set of totals into this one.
+     * @param[in] other Totals gathered by a different worker.
+     */
+    void merge(const SimStats& other);
+
+    /**
+     * @brief Returns the number of games recorded.
+     * @return Game count.
+     */
+    std::size_t gameCount() const { return games; }
+
+    /**
+     * @brief Writes per-company and per-card tables.
+     * @param[in,out] out Stream to write to.
+     */
+    void print(std::ostream& out) const;
+
+private:
+    /** @brief Totals for one company across all games it appeared in. */
+    struct CompanyTotals {
+        std::size_t games = 0;                      ///< Games played.
+        std::size_t wins = 0;                       ///< Games won.
+        std::size_t territory = 0;                  ///< Sum of largest territories.
+        std::size_t tiles = 0;                      ///< Sum of tiles owned.
+        std::map<std::string, long long> resources; ///< Sum of final resources.
+    };
+
+    /** @brief Totals for one card across all games. */
+    struct CardTotals {
+        std::size_t timesPlayed = 0;        ///< Copies played by anyone.
+        std::size_t playsByWinner = 0;      ///< Copies played by the eventual winner.
+        std::size_t gamesPlayedIn = 0;      ///< Games in which anyone played it.
+        std::size_t winnerGames = 0;        ///< Games in which the winner played it.
+    };
+
+    std::size_t games = 0;                          ///< Games recorded.
+    std::map<std::string, CompanyTotals> companies; ///< Per-company totals, keyed by name.
+    std::map<std::string, CardTotals> cards;        ///< Per-card totals, keyed by name.
+};
@@ -13,6 +13,8 @@
  */
 
 #pragma once
+#include <cstdint>
+#include "Rng.hpp"
 
 /**
  * @class StartupMenu
@@ -37,4 +39,33 @@ public:
      * @return 0 on successful completion or user exit.
      */
     int StartMenuLoop();
+
+    /**
+     * @brief Forces the random engine used by the next game.
+     * @details Takes precedence over the engine stored in the settings file.
+     * @param engine Algorithm to use.
+     */
+    void setEngineOverride(RngEngine engine);
+
+    /**
+     * @brief Forces the seed used by the next game, making it reproducible.
+     * @details Takes precedence over any seed stored in the settings file.
+     * @param seed Seed value.
+     */
+    void setSeedOverride(std::uint64_t seed);
+
+    /**
+     * @brief Overrides the frame cap of the next game's window.
+     * @param limit Maximum frames per second, or 0 for no limit.
+     * @see Game::setFrameLimit()
+     */
+    void setFrameLimitOverride(unsigned int limit);
+
+private:
+    bool hasEngineOverride = false;                 /**< True if setEngineOverride() was called. */
+    RngEngine engineOverride = RngEngine::Mt19937;  /**< Engine from the command line. */
+    bool hasSeedOverride = false;                   /**< True if setSeedOverride() was called. */
+    std::uint64_t seedOverride = 0;                 /**< Seed from the command line. */
+    bool hasFrameLimitOverride = false;             /**< True if setFrameLimitOverride() was called. */
+    unsigned int frameLimitOverride = 0;            /**< Frame cap from the command line. */
 };
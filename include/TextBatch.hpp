@@ -0,0 +1,87 @@
+/**
+ * @file TextBatch.hpp
+ * @brief Declares TextBatch, which draws many short strings of one font size in a single call.
+ *
+ * @details
+ * An sf::Text per label costs a layout pass and a draw call each, which grows with the
+ * number of tiles. A TextBatch lays strings out once as textured triangles over the
+ * font's glyph page for its character size and keeps them in one vertex array, so
+ * any number of labels is drawn with one call.
+ *
+ * @see Renderer
+ *
+ * @date 2025-11-06
+ * @version 1.0
+ * @author
+ * Owen Chilson
+ */
+
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <vector>
+
+/**
+ * @class TextBatch
+ * @brief A vertex array of pre-laid-out glyph quads sharing one font and character size.
+ */
+class TextBatch : public sf::Drawable {
+public:
+    /**
+     * @brief Creates an empty batch.
+     * @param font Font to lay out and draw with; must outlive the batch.
+     * @param characterSize Character size in pixels, shared by every string in the batch.
+     */
+    TextBatch(const sf::Font& font, unsigned int characterSize);
+
+    /**
+     * @brief Lays out a string centered on the origin.
+     * @details Centers the same way as setting an sf::Text's origin to half its local size.
+     * @param text String to lay out; one line of 8-bit characters.
+     * @param color Vertex color of the glyphs.
+     * @param[out] out Replaced with six vertices per visible glyph.
+     */
+    void layout(const std::string& text, const sf::Color& color, std::vector<sf::Vertex>& out) const;
+
+    /**
+     * @brief Appends glyphs from layout(), translated to a position.
+     * @param glyphs Vertices produced by layout() on a batch of the same font and size.
+     * @param center Where the string's center is drawn.
+     */
+    void append(const std::vector<sf::Vertex>& glyphs, const sf::Vector2f& center);
+
+    /**
+     * @brief Lays out a string and appends it centered on a position.
+     * @param text String to add.
+     * @param center Where the string's center is drawn.
+     * @param color Vertex color of the glyphs.
+     */
+    void add(const std::string& text, const sf::Vector2f& center, const sf::Color& color);
+
+    /** @brief Removes every string, keeping the allocated capacity. */
+    void clear();
+
+    /** @brief Returns the number of vertices in the batch. */
+    std::size_t getVertexCount() const { return vertices.size(); }
+
+    /**
+     * @brief Draws a contiguous part of the batch.
+     * @details Lets callers that record getVertexCount() before each add() draw only the
+     *          strings that are on screen.
+     * @param target Where to draw.
+     * @param first Index of the first vertex to draw.
+     * @param count Number of vertices to draw.
+     * @param states Render states; the texture is replaced by the font's glyph page.
+     */
+    void drawRange(sf::RenderTarget& target, std::size_t first, std::size_t count,
+                   sf::RenderStates states = sf::RenderStates::Default) const;
+
+private:
+    /** @brief Draws every glyph with the font's page texture for this size. */
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+    const sf::Font& font;               ///< Font supplying glyph metrics and texture.
+    unsigned int characterSize;         ///< Character size of every string in the batch.
+    std::vector<sf::Vertex> vertices;   ///< Glyph triangles, six vertices per glyph.
+    std::vector<sf::Vertex> scratch;    ///< Reused by add() to avoid an allocation per string.
+};
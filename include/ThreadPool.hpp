@@ -0,0 +1,97 @@
+/**
+ * @file ThreadPool.hpp
+ * @brief Declares the ThreadPool class, a work-stealing pool for running independent jobs in parallel.
+ *
+ * @details
+ * Each worker thread owns a task deque. Workers pop their own newest task first
+ * and, when empty, steal the oldest task from another worker, which keeps all
+ * cores busy without a single contended queue. Used by the batch self-play
+ * runner to spread games across every available core.
+ *
+ * @see SelfPlay.hpp
+ *
+ * @date 2025-11-06
+ * @version 1.0
+ * @author
+ * Owen Chilson
+ */
+
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class ThreadPool
+ * @brief Fixed-size pool of worker threads with per-worker queues and work stealing.
+ */
+class ThreadPool {
+public:
+    /**
+     * @brief Starts the worker threads.
+     * @param[in] threadCount Number of workers; 0 selects std::thread::hardware_concurrency().
+     * @post All workers are running and idle.
+     */
+    explicit ThreadPool(std::size_t threadCount = 0);
+
+    /**
+     * @brief Finishes all queued tasks, then stops and joins the workers.
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Queues a task for execution.
+     * @details
+     * Tasks submitted from a worker go to that worker's own queue; tasks from other
+     * threads are distributed round-robin across workers.
+     * @param[in] task The job to run. Must not throw.
+     */
+    void submit(std::function<void()> task);
+
+    /**
+     * @brief Blocks until every submitted task has finished.
+     */
+    void wait();
+
+    /**
+     * @brief Returns the number of worker threads.
+     * @return Worker count.
+     */
+    std::size_t size() const { return workers.size(); }
+
+private:
+    /** @brief A worker's task deque and the mutex guarding it. */
+    struct WorkerQueue {
+        std::mutex mutex;                           /**< Guards tasks. */
+        std::deque<std::function<void()>> tasks;    /**< Pending tasks, newest at the back. */
+    };
+
+    /** @brief Main loop executed by each worker thread. */
+    void workerLoop(std::size_t index);
+
+    /**
+     * @brief Takes a task from the worker's own queue, or steals one from another worker.
+     * @return True if a task was obtained.
+     */
+    bool tryTake(std::size_t index, std::function<void()>& task);
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues; /**< One queue per worker. */
+    std::vector<std::thread> workers;                 /**< Worker threads. */
+
+    std::mutex stateMutex;                   /**< Guards sleeping, waking and completion. */
+    std::condition_variable workAvailable;   /**< Signaled when tasks are queued or on shutdown. */
+    std::condition_variable allDone;         /**< Signaled when pending drops to zero. */
+    std::atomic<std::size_t> queued{0};      /**< Tasks sitting in queues. */
+    std::size_t pending = 0;                 /**< Tasks submitted but not yet finished. */
+    std::atomic<std::size_t> nextQueue{0};   /**< Round-robin cursor for external submits. */
+    bool stopping = false;                   /**< Set by the destructor. */
+};
@@ -4,7 +4,7 @@
  *
  * @details
  * Each Tile tracks its ownership by a Company and a color state, providing methods
- * for setting and retrieving this information. Tiles default to being unowned and "neutral" in color.
+ * for setting and retrieving this information. Tiles default to being unowned and Neutral in color.
  * 
  * @date 2025-11-06
  * @version 1.0
@@ -13,15 +13,15 @@
  */
 
 #pragma once
-#include <string>
 #include "Company.hpp"
+#include "ColorId.hpp"
 
 /**
  * @class Tile
  * @brief Represents a single board tile that can be owned by a company and display a color.
  *
  * Each tile may have an owner (a pointer to a Company) and an associated color.
- * Tiles start unowned and "neutral" in color by default.
+ * Tiles start unowned and ColorId::Neutral by default.
  */
 class Tile {
 public:
@@ -44,15 +44,15 @@ public:
 
     /**
      * @brief Gets the tile's current color.
-     * @return Reference to the color string.
+     * @return The interned color identifier.
      */
-    const std::string& getColor() const;
+    ColorId getColor() const;
 
     /**
      * @brief Sets the tile's color.
-     * @param newColor New color name (string identifier).
+     * @param newColor New color identifier.
      */
-    void setColor(const std::string& newColor);
+    void setColor(ColorId newColor);
 
     /**
      * @brief Prints a formatted line describing ownership and color to the console.
@@ -61,5 +61,5 @@ public:
 
 private:
     Company* owner;          /**< Pointer to the owning company (nullptr if unowned). */
-    std::string color;       /**< Color of the tile, defaults to "neutral". */
+    ColorId color;           /**< Color of the tile, defaults to ColorId::Neutral. */
 };
@@ -0,0 +1,104 @@
+/**
+ * @file TriggerBatch.hpp
+ * @brief Declares TriggerBatch, a subscription list that fires one trigger for many played cards at once.
+ *
+ * @details
+ * Instead of walking every player's play area and firing each card individually,
+ * the engine subscribes a card when it is played and unsubscribes it when it leaves
+ * play. Copies of the same card held by the same player share one subscription with
+ * a copy count, so firing the batch is a single pass over compact entries whose
+ * resource effects are summed per player and applied once.
+ *
+ * @see CardDefinition, GameEngine::startNewDay()
+ *
+ * @date 2025-11-06
+ * @version 1.0
+ * @author
+ * Owen Chilson
+ */
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "Card.hpp"
+#include "Resources.hpp"
+
+/**
+ * @struct ResourceDelta
+ * @brief Net resource change for one player, accumulated over a batch.
+ */
+struct ResourceDelta {
+    std::array<int, KNOWN_RESOURCE_COUNT> known{};      ///< Change per standard resource.
+    std::vector<std::pair<ResourceId, int>> extra;      ///< Changes to other resources.
+
+    /** @brief Accumulates a change to one resource. */
+    void add(ResourceId type, int amount);
+
+    /** @brief Returns true if nothing changed. */
+    bool empty() const;
+
+    /** @brief Resets to no change, keeping allocated capacity. */
+    void clear();
+};
+
+/**
+ * @class TriggerBatch
+ * @brief Played cards subscribed to one trigger, grouped by player and definition.
+ */
+class TriggerBatch {
+public:
+    /**
+     * @brief Creates an empty batch for a trigger.
+     * @param trigger The trigger this batch fires.
+     */
+    explicit TriggerBatch(CardTrigger trigger);
+
+    /**
+     * @brief Subscribes one played copy of a card.
+     * @details Cards without actions for this trigger are ignored.
+     * @param playerIndex Owner of the card.
+     * @param definition The card's definition.
+     */
+    void subscribe(std::size_t playerIndex, const CardDefinition& definition);
+
+    /**
+     * @brief Removes every copy of a card a player had subscribed.
+     * @param playerIndex Owner of the cards.
+     * @param id Definition of the cards leaving play.
+     */
+    void unsubscribeAll(std::size_t playerIndex, CardId id);
+
+    /** @brief Removes all subscriptions. */
+    void clear();
+
+    /** @brief Returns the number of distinct (player, card) subscriptions. */
+    std::size_t size() const { return subscriptions.size(); }
+
+    /**
+     * @brief Evaluates every subscribed card and sums the effects per player.
+     * @param[in,out] deltas One entry per player; cleared, then filled.
+     */
+    void collect(std::vector<ResourceDelta>& deltas) const;
+
+private:
+    /** @brief All copies of one card in one player's play area. */
+    struct Subscription {
+        const CardDefinition* definition;   ///< Shared card definition.
+        std::uint32_t playerIndex;          ///< Owner of the copies.
+        std::uint32_t copies;               ///< Number of copies in play.
+    };
+
+    /** @brief Packs a player index and card id into a lookup key; the id fills the low 32 bits. */
+    static std::uint64_t keyOf(std::size_t playerIndex, CardId id) {
+        static_assert(sizeof(CardId) <= sizeof(std::uint32_t), "keyOf packs the card id into 32 bits");
+        return (static_cast<std::uint64_t>(playerIndex) << 32) | id;
+    }
+
+    CardTrigger trigger;                                    ///< Trigger fired by this batch.
+    std::vector<Subscription> subscriptions;                ///< Entries, in no particular order.
+    std::unordered_map<std::uint64_t, std::size_t> positions;   ///< Entry position by keyOf().
+};
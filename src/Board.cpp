@@ -1,8 +1,8 @@
 #include "Board.hpp"
-#include "Colors.hpp"
 #include <iostream>
 #include <iomanip>
 #include <cmath>
+#include <algorithm>
 #include <map>
 
 /**
@@ -11,13 +11,17 @@
  * Used to compute neighboring tiles via coordinate addition.
  * These six directions correspond to the edges of a hexagon.
  */
-static const std::vector<CubeCoord> DIRECTIONS = {
+static constexpr CubeCoord DIRECTIONS[Board::NEIGHBOR_COUNT] = {
     CubeCoord(1, -1, 0), CubeCoord(1, 0, -1), CubeCoord(0, 1, -1),
     CubeCoord(-1, 1, 0), CubeCoord(-1, 0, 1), CubeCoord(0, -1, 1)
 };
 
 /** @brief Initializes a new Board and immediately generates its tiles. */
-Board::Board(int radius_) : radius(radius_) {
+Board::Board(int radius_)
+    : radius(radius_),
+      ownerRegions(BoardView::UNOWNED),
+      colorRegions(static_cast<std::uint8_t>(ColorId::Neutral))
+{
     generateBoard();
 }
 
@@ -25,39 +29,93 @@ Board::Board(int radius_) : radius(radius_) {
  * @details
  * Generates all cube coordinates where |x|, |y|, and |z| are within radius,
  * satisfying the invariant x + y + z = 0.
- * Each valid coordinate is inserted into the board’s tile map.
+ * Tiles are appended one axial row (constant z) at a time so that each row is
+ * contiguous; the row's starting index minus its minimum q is stored in rowOffsets.
+ * Once all coordinates are known, each tile's neighbors are resolved in
+ * DIRECTIONS order so later queries never touch the coordinate math again.
  */
 void Board::generateBoard() {
-    for (int x = -radius; x <= radius; ++x) {
-        for (int y = -radius; y <= radius; ++y) {
-            int z = -x - y;
-            if (std::abs(z) <= radius) {
-                tiles.emplace(CubeCoord(x, y, z), Tile{});
-            }
+    const int tileTotal = 3 * radius * (radius + 1) + 1;
+    tiles.assign(tileTotal, Tile{});
+    coords.clear();
+    coords.reserve(tileTotal);
+    rowOffsets.assign(2 * radius + 1, 0);
+
+    for (int z = -radius; z <= radius; ++z) {
+        int xMin = std::max(-radius, -radius - z);
+        int xMax = std::min(radius, radius - z);
+        rowOffsets[z + radius] = static_cast<int>(coords.size()) - xMin;
+
+        for (int x = xMin; x <= xMax; ++x) {
+            coords.emplace_back(x, -x - z, z);
+        }
+    }
+
+    neighborTable.resize(tileTotal);
+    for (int i = 0; i < tileTotal; ++i) {
+        for (int d = 0; d < NEIGHBOR_COUNT; ++d) {
+            neighborTable[i][d] = indexOf(coords[i] + DIRECTIONS[d]);
         }
     }
+
+    view.resize(tileTotal);
+    ownerRegions.rebuild(*this, view.ownerData());
+    colorRegions.rebuild(*this, view.colorData());
+    markAllDirty();
+}
+
+/**
+ * @details
+ * All three components are range-checked with a single unsigned comparison each,
+ * so off-board coordinates are rejected without data-dependent branching on the
+ * sign. Valid coordinates resolve with one table read and an add.
+ */
+int Board::indexOf(const CubeCoord& coord) const {
+    const unsigned span = static_cast<unsigned>(2 * radius);
+    bool inside = (static_cast<unsigned>(coord.x + radius) <= span) &
+                  (static_cast<unsigned>(coord.y + radius) <= span) &
+                  (static_cast<unsigned>(coord.z + radius) <= span) &
+                  (coord.x + coord.y + coord.z == 0);
+    if (!inside) return INVALID_INDEX;
+    return rowOffsets[coord.z + radius] + coord.x;
 }
 
 /** @brief Returns a pointer to the Tile at the given cube coordinate, or nullptr if missing. */
 Tile* Board::getTile(const CubeCoord& coord) {
-    auto it = tiles.find(coord);
-    if (it != tiles.end()) return &it->second;
-    return nullptr;
+    int index = indexOf(coord);
+    return index != INVALID_INDEX ? &tiles[index] : nullptr;
+}
+
+/** @brief Const overload of getTile(). */
+const Tile* Board::getTile(const CubeCoord& coord) const {
+    int index = indexOf(coord);
+    return index != INVALID_INDEX ? &tiles[index] : nullptr;
 }
 
 /**
  * @details
- * Iterates through the six cube-coordinate directions to find
- * all existing adjacent tiles. Excludes invalid or out-of-bounds tiles.
+ * Reads the precomputed neighbor slots of an on-board tile and converts the
+ * existing ones back to coordinates. A coordinate off the board has no slots,
+ * so each of its six steps is probed through indexOf() instead; one just past
+ * the edge therefore still reports the board tiles it touches.
  */
 std::vector<CubeCoord> Board::getNeighbors(const CubeCoord& coord) const {
     std::vector<CubeCoord> result;
-    for (auto& dir : DIRECTIONS) {
-        CubeCoord neighbor = coord + dir;
-        if (tiles.find(neighbor) != tiles.end()) {
-            result.push_back(neighbor);
+    result.reserve(NEIGHBOR_COUNT);
+
+    int index = indexOf(coord);
+    if (index == INVALID_INDEX) {
+        for (const CubeCoord& dir : DIRECTIONS) {
+            CubeCoord neighbor = coord + dir;
+            if (indexOf(neighbor) != INVALID_INDEX)
+                result.push_back(neighbor);
         }
+        return result;
     }
+
+    forEachNeighbor(index, [&](int neighbor) {
+        result.push_back(coords[neighbor]);
+    });
     return result;
 }
 
@@ -67,26 +125,101 @@ std::vector<CubeCoord> Board::getNeighbors(const CubeCoord& coord) const {
  * Useful for territory claiming or resource control systems.
  */
 void Board::setTileOwner(int x, int y, int z, Company* company) {
-    CubeCoord coord(x, y, z);
-    Tile* tile = getTile(coord);
-    if (tile) tile->setOwner(company);
+    int index = indexOf(CubeCoord(x, y, z));
+    if (index != INVALID_INDEX) setTileOwner(static_cast<std::size_t>(index), company);
 }
 
 /**
  * @details
- * Validates the target coordinate and color before assignment.
- * Logs errors if either is invalid but continues execution safely.
+ * Validates the target coordinate before assignment. The color is already
+ * an interned ColorId, so names are validated by the caller at parse time.
+ * Logs an error if the tile is missing but continues execution safely.
  */
-void Board::setTileColor(int x, int y, int z, const std::string& color) {
-    CubeCoord coord(x, y, z);
-    Tile* tile = getTile(coord);
+void Board::setTileColor(int x, int y, int z, ColorId color) {
+    int index = indexOf(CubeCoord(x, y, z));
 
-    if (!tile) {
+    if (index == INVALID_INDEX) {
         std::cerr << "Tile (" << x << "," << y << "," << z << ") does not exist.\n";
         return;
     } 
-    if (!Colors::isValid(color)) {
-        std::cerr << "Color \"" << color << "\" is not a valid color.\n";
+    setTileColor(static_cast<std::size_t>(index), color);
+}
+
+/** @brief Writes the owner to the tile and the BoardView, then updates owner regions. */
+void Board::setTileOwner(std::size_t index, Company* company) {
+    std::uint8_t oldOwner = view.ownerData()[index];
+    tiles[index].setOwner(company);
+    view.setOwner(index, company);
+    ownerRegions.onLabelChanged(*this, view.ownerData(), index, oldOwner);
+    markDirty(index);
+}
+
+/** @brief Writes the color to the tile and the BoardView, then updates color regions. */
+void Board::setTileColor(std::size_t index, ColorId color) {
+    std::uint8_t oldColor = view.colorData()[index];
+    tiles[index].setColor(color);
+    view.setColor(index, color);
+    colorRegions.onLabelChanged(*this, view.colorData(), index, oldColor);
+    markDirty(index);
+}
+
+void Board::resyncView() {
+    view.sync(*this);
+    ownerRegions.invalidate();
+    colorRegions.invalidate();
+    markAllDirty();
+}
+
+// The byte flags keep dirtyTiles duplicate-free, so it never outgrows the board
+// even when nothing drains it, as in headless games.
+void Board::markDirty(std::size_t index) {
+    if (!tileDirty[index]) {
+        tileDirty[index] = 1;
+        dirtyTiles.push_back(static_cast<int>(index));
     }
-    tile->setColor(color);
+}
+
+void Board::markAllDirty() {
+    tileDirty.assign(tiles.size(), 1);
+    dirtyTiles.resize(tiles.size());
+    for (std::size_t i = 0; i < tiles.size(); ++i)
+        dirtyTiles[i] = static_cast<int>(i);
+}
+
+void Board::clearDirtyTiles() {
+    for (int index : dirtyTiles)
+        tileDirty[index] = 0;
+    dirtyTiles.clear();
+}
+
+/**
+ * @details
+ * Additions are merged eagerly by the trackers; only removals leave them
+ * dirty, and the cost of rebuilding is paid here, once, on the next query.
+ */
+void Board::refreshRegions() const {
+    if (ownerRegions.needsRebuild())
+        ownerRegions.rebuild(*this, view.ownerData());
+    if (colorRegions.needsRebuild())
+        colorRegions.rebuild(*this, view.colorData());
+}
+
+std::size_t Board::getTerritorySize(const CubeCoord& coord) const {
+    int index = indexOf(coord);
+    if (index == INVALID_INDEX) return 0;
+    refreshRegions();
+    return ownerRegions.regionSize(static_cast<std::size_t>(index));
+}
+
+std::size_t Board::getLargestTerritory(const Company* company) const {
+    std::uint8_t ownerId;
+    if (!company || !view.findOwnerId(company, ownerId)) return 0;
+    refreshRegions();
+    return ownerRegions.largestRegion(ownerId);
+}
+
+std::size_t Board::getLargestColorRegion(ColorId color) const {
+    if (color == ColorId::Neutral) return 0;
+    refreshRegions();
+    return colorRegions.largestRegion(static_cast<std::uint8_t>(color));
 }
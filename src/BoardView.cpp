@@ -0,0 +1,122 @@
+#include "BoardView.hpp"
+#include "Board.hpp"
+#include <algorithm>
+#include <iostream>
+
+BoardView::BoardView() : owners{nullptr} {}
+
+void BoardView::resize(std::size_t tileCount) {
+    ownerIds.assign(tileCount, UNOWNED);
+    colors.assign(tileCount, static_cast<std::uint8_t>(ColorId::Neutral));
+}
+
+// Full resynchronization; owner ids already interned stay stable.
+void BoardView::sync(const Board& board) {
+    resize(board.tileCount());
+    for (std::size_t i = 0; i < board.tileCount(); ++i) {
+        ownerIds[i] = internOwner(board.tiles[i].getOwner());
+        colors[i] = static_cast<std::uint8_t>(board.tiles[i].getColor());
+    }
+}
+
+void BoardView::setOwner(std::size_t index, const Company* company) {
+    ownerIds[index] = internOwner(company);
+}
+
+// Companies are few, so a linear scan of the palette is cheaper than hashing.
+std::uint8_t BoardView::internOwner(const Company* company) {
+    std::uint8_t id;
+    if (findOwnerId(company, id))
+        return id;
+
+    if (owners.size() >= BYTE_BINS) {
+        std::cerr << "Error: BoardView cannot track more than " << BYTE_BINS - 1 << " owners.\n";
+        return UNOWNED;
+    }
+    owners.push_back(company);
+    return static_cast<std::uint8_t>(owners.size() - 1);
+}
+
+bool BoardView::findOwnerId(const Company* company, std::uint8_t& id) const {
+    auto it = std::find(owners.begin(), owners.end(), company);
+    if (it == owners.end())
+        return false;
+    id = static_cast<std::uint8_t>(it - owners.begin());
+    return true;
+}
+
+std::size_t BoardView::countOwnedBy(const Company* company) const {
+    std::uint8_t id;
+    if (!findOwnerId(company, id))
+        return 0;
+    return countEqual(ownerIds.data(), ownerIds.size(), id);
+}
+
+std::size_t BoardView::countColor(ColorId color) const {
+    return countEqual(colors.data(), colors.size(), static_cast<std::uint8_t>(color));
+}
+
+void BoardView::ownerHistogram(std::vector<std::uint32_t>& bins) const {
+    std::uint32_t full[BYTE_BINS];
+    histogram(ownerIds.data(), ownerIds.size(), full);
+    bins.assign(full, full + owners.size());
+}
+
+void BoardView::colorHistogram(std::array<std::uint32_t, COLOR_COUNT>& bins) const {
+    std::uint32_t full[BYTE_BINS];
+    histogram(colors.data(), colors.size(), full);
+    std::copy(full, full + COLOR_COUNT, bins.begin());
+}
+
+// Iterative flood fill; each tile is pushed at most once.
+std::size_t BoardView::largestRegion(const Board& board, std::uint8_t ownerId) const {
+    std::vector<std::uint8_t> visited(ownerIds.size(), 0);
+    std::vector<int> stack;
+    std::size_t best = 0;
+
+    for (std::size_t start = 0; start < ownerIds.size(); ++start) {
+        if (visited[start] || ownerIds[start] != ownerId)
+            continue;
+
+        std::size_t regionSize = 0;
+        visited[start] = 1;
+        stack.push_back(static_cast<int>(start));
+        while (!stack.empty()) {
+            int current = stack.back();
+            stack.pop_back();
+            ++regionSize;
+            board.forEachNeighbor(current, [&](int neighbor) {
+                if (!visited[neighbor] && ownerIds[neighbor] == ownerId) {
+                    visited[neighbor] = 1;
+                    stack.push_back(neighbor);
+                }
+            });
+        }
+        best = std::max(best, regionSize);
+    }
+    return best;
+}
+
+std::size_t BoardView::countEqual(const std::uint8_t* data, std::size_t count, std::uint8_t value) {
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < count; ++i)
+        total += (data[i] == value);
+    return total;
+}
+
+void BoardView::histogram(const std::uint8_t* data, std::size_t count, std::uint32_t* bins) {
+    std::uint32_t partial[4][BYTE_BINS] = {};
+
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        ++partial[0][data[i]];
+        ++partial[1][data[i + 1]];
+        ++partial[2][data[i + 2]];
+        ++partial[3][data[i + 3]];
+    }
+    for (; i < count; ++i)
+        ++partial[0][data[i]];
+
+    for (std::size_t b = 0; b < BYTE_BINS; ++b)
+        bins[b] = partial[0][b] + partial[1][b] + partial[2][b] + partial[3][b];
+}
@@ -1,38 +1,109 @@
 #include "Card.hpp"
 #include "Player.hpp"
+#include "EventSink.hpp"
 #include <iostream>
 
-// Construct a Card from JSON data.
-Card::Card(const nlohmann::json& data) {
+// Trigger names in CardTrigger order.
+static const char* const TRIGGER_NAMES[CARD_TRIGGER_COUNT] = { "onPlay", "onStartOfDay" };
+
+// Construct a CardDefinition from JSON data, compiling its triggers into instructions.
+CardDefinition::CardDefinition(const nlohmann::json& data) {
     name = data.value("name", "Unnamed Card");
     description = data.value("description", "");
 
-    // Parse triggers if present.
+    // Decode each trigger's actions; buckets are concatenated into code afterwards.
+    std::array<std::vector<CardInstruction>, CARD_TRIGGER_COUNT> compiled;
     if (data.contains("triggers") && data["triggers"].is_object()) {
         for (auto& [triggerName, actions] : data["triggers"].items()) {
-            if (actions.is_array()) {
-                triggers[triggerName] = actions.get<std::vector<nlohmann::json>>();
+            CardTrigger trigger;
+            if (!tryParseTrigger(triggerName, trigger)) {
+                std::cerr << "Warning: card '" << name << "' has unknown trigger '" << triggerName << "'\n";
+                continue;
+            }
+            if (!actions.is_array()) continue;
+
+            for (const auto& action : actions) {
+                std::string actionType = action.value("action", "");
+
+                if (actionType == "addResource") {
+                    CardInstruction instruction;
+                    instruction.op = CardOp::AddResource;
+                    instruction.resource = Resources::intern(action.value("type", ""));
+                    instruction.amount = action.value("amount", 0);
+                    compiled[static_cast<std::size_t>(trigger)].push_back(std::move(instruction));
+                } else {
+                    std::cerr << "Warning: card '" << name << "' has unknown action '" << actionType << "'\n";
+                }
+
+                // Future action types (e.g., removeResource, drawCard, etc.) can be added here.
             }
         }
     }
+
+    for (std::size_t t = 0; t < CARD_TRIGGER_COUNT; ++t) {
+        triggerStart[t] = static_cast<std::uint16_t>(code.size());
+        for (auto& instruction : compiled[t])
+            code.push_back(std::move(instruction));
+    }
+    triggerStart[CARD_TRIGGER_COUNT] = static_cast<std::uint16_t>(code.size());
 }
 
 // Execute all actions associated with the given trigger.
-void Card::executeTrigger(const std::string& trigger, Player& player) const {
-    auto it = triggers.find(trigger);
-    if (it == triggers.end()) return;  // No actions tied to this trigger.
-
-    for (const auto& action : it->second) {
-        std::string actionType = action.value("action", "");
-        
-        if (actionType == "addResource") {
-            std::string type = action.value("type", "");
-            int amount = action.value("amount", 0);
-            player.addResource(type, amount);
-            std::cout << player.name << " gains " << amount << " " << type
-                      << " from " << name << " (" << trigger << ")\n";
+void CardDefinition::executeTrigger(CardTrigger trigger, Player& player, EventSink* events) const {
+    const std::size_t t = static_cast<std::size_t>(trigger);
+
+    for (std::size_t i = triggerStart[t]; i < triggerStart[t + 1]; ++i) {
+        const CardInstruction& instruction = code[i];
+
+        switch (instruction.op) {
+        case CardOp::AddResource:
+            player.addResource(instruction.resource, instruction.amount);
+            if (events) {
+                GameEvent event;
+                event.type = GameEventType::ResourceGained;
+                event.trigger = trigger;
+                event.resource = instruction.resource;
+                event.amount = instruction.amount;
+                event.player = &player;
+                event.card = this;
+                events->emit(event);
+            }
+            break;
         }
+    }
+}
 
-        // Future action types (e.g., removeResource, drawCard, etc.) can be added here.
+void CardDefinition::executeTrigger(const std::string& trigger, Player& player, EventSink* events) const {
+    CardTrigger parsed;
+    if (tryParseTrigger(trigger, parsed))
+        executeTrigger(parsed, player, events);
+}
+
+bool CardDefinition::hasTrigger(CardTrigger trigger) const {
+    const std::size_t t = static_cast<std::size_t>(trigger);
+    return triggerStart[t] != triggerStart[t + 1];
+}
+
+bool CardDefinition::tryParseTrigger(const std::string& triggerName, CardTrigger& out) {
+    for (std::size_t t = 0; t < CARD_TRIGGER_COUNT; ++t) {
+        if (triggerName == TRIGGER_NAMES[t]) {
+            out = static_cast<CardTrigger>(t);
+            return true;
+        }
     }
+    return false;
+}
+
+const char* CardDefinition::triggerName(CardTrigger trigger) {
+    return TRIGGER_NAMES[static_cast<std::size_t>(trigger)];
+}
+
+const std::string& Card::getName() const {
+    static const std::string empty;
+    return definition ? definition->name : empty;
+}
+
+void Card::executeTrigger(CardTrigger trigger, Player& player, EventSink* events) const {
+    if (definition)
+        definition->executeTrigger(trigger, player, events);
 }
@@ -0,0 +1,66 @@
+#include "CardCatalog.hpp"
+#include "PathUtils.hpp"
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <unordered_map>
+
+namespace {
+
+/** @brief Cached catalog and the file state it was loaded from. */
+struct CacheEntry {
+    std::uintmax_t size = 0;
+    std::filesystem::file_time_type writeTime{};
+    std::shared_ptr<const CardCatalog> catalog;
+};
+
+std::mutex cacheMutex;
+std::unordered_map<std::string, CacheEntry> cache;
+
+} // namespace
+
+CardCatalog::CardCatalog(const std::string& filename) {
+    Deck deck;
+    deck.loadCardPool(filename, registry);
+    pool.reserve(deck.size());
+    copiesById.resize(registry.size());
+    for (const Card& card : deck.cards) {
+        pool.push_back(card.getId());
+        ++copiesById[card.getId()];
+    }
+}
+
+/**
+ * @details
+ * The load runs with the cache locked. Games started together all want the same file,
+ * so making them wait for one parse is cheaper than letting each thread parse its own.
+ * A missing file is cached as an empty catalog too, so its error is reported once.
+ */
+std::shared_ptr<const CardCatalog> CardCatalog::get(const std::string& filename) {
+    const std::filesystem::path path = PathUtils::getAssetPath(filename);
+
+    std::error_code ec;
+    std::uintmax_t size = std::filesystem::file_size(path, ec);
+    if (ec)
+        size = 0;
+    std::filesystem::file_time_type writeTime = std::filesystem::last_write_time(path, ec);
+    if (ec)
+        writeTime = {};
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    CacheEntry& entry = cache[path.string()];
+    if (!entry.catalog || entry.size != size || entry.writeTime != writeTime) {
+        entry.catalog = std::shared_ptr<const CardCatalog>(new CardCatalog(filename));
+        entry.size = size;
+        entry.writeTime = writeTime;
+    }
+    return entry.catalog;
+}
+
+/** @brief Copies handles rather than definitions; the deck must not outlive this catalog. */
+void CardCatalog::fillDeck(Deck& deck) const {
+    deck.cards.clear();
+    deck.cards.reserve(pool.size());
+    for (std::size_t i = 0; i < pool.size(); ++i)
+        deck.cards.emplace_back(&registry.get(pool[i]), static_cast<std::uint32_t>(i + 1));
+}
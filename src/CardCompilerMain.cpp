@@ -0,0 +1,22 @@
+#include <iostream>
+#include <string>
+#include "CardDatabase.hpp"
+
+/**
+ * @brief Compiles a JSON card file into the binary card database.
+ *
+ * Run by the build whenever cards.json changes; can also be run by hand after editing cards.
+ */
+int main(int argc, char** argv) {
+    if (argc != 3) {
+        std::cerr << "Usage: spotlight_cardc <cards.json> <cards.bin>\n";
+        return 1;
+    }
+
+    std::string error;
+    if (!CardDatabase::compile(argv[1], argv[2], error)) {
+        std::cerr << "spotlight_cardc: " << error << "\n";
+        return 1;
+    }
+    return 0;
+}
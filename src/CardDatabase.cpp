@@ -0,0 +1,329 @@
+#include "CardDatabase.hpp"
+#include "CardJsonReader.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <unordered_map>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+const char MAGIC[4] = {'S', 'P', 'C', 'B'};
+
+struct Header {
+    char magic[4];
+    std::uint32_t version;
+    std::uint32_t cardCount;
+    std::uint32_t instructionCount;
+    std::uint32_t resourceCount;
+    std::uint32_t stringBytes;
+    std::uint64_t sourceSize;       // Size of the JSON the table was built from
+    std::int64_t sourceTime;        // Its last_write_time, in file_clock ticks
+};
+
+struct CardRecord {
+    std::uint32_t nameOffset;
+    std::uint32_t nameLength;
+    std::uint32_t descriptionOffset;
+    std::uint32_t descriptionLength;
+    std::uint32_t copies;
+    std::uint32_t firstInstruction;
+    std::uint16_t triggerStart[CARD_TRIGGER_COUNT + 1];
+    std::uint16_t padding;
+};
+
+struct InstructionRecord {
+    std::uint8_t op;
+    std::uint8_t padding;
+    std::uint16_t resource;         // Index into the resource records
+    std::int32_t amount;
+};
+
+struct ResourceRecord {
+    std::uint32_t nameOffset;
+    std::uint32_t nameLength;
+};
+
+static_assert(sizeof(CardRecord) == 32 && sizeof(InstructionRecord) == 8 && sizeof(ResourceRecord) == 8,
+              "Card database records must stay tightly packed; bump VERSION when changing them");
+
+/** @brief Read-only memory mapping of a whole file. */
+class MappedFile {
+public:
+    explicit MappedFile(const std::filesystem::path& path) {
+#ifdef _WIN32
+        file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                           FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return;
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+            return;
+        mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping)
+            return;
+        data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+        if (data)
+            length = static_cast<std::size_t>(fileSize.QuadPart);
+#else
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            return;
+        struct stat info;
+        if (fstat(fd, &info) == 0 && info.st_size > 0) {
+            void* mapped = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapped != MAP_FAILED) {
+                data = static_cast<const char*>(mapped);
+                length = static_cast<std::size_t>(info.st_size);
+            }
+        }
+        close(fd);
+#endif
+    }
+
+    ~MappedFile() {
+#ifdef _WIN32
+        if (data) UnmapViewOfFile(data);
+        if (mapping) CloseHandle(mapping);
+        if (file != INVALID_HANDLE_VALUE) CloseHandle(file);
+#else
+        if (data) munmap(const_cast<char*>(data), length);
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* begin() const { return data; }
+    std::size_t size() const { return length; }
+
+private:
+    const char* data = nullptr;
+    std::size_t length = 0;
+#ifdef _WIN32
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = nullptr;
+#endif
+};
+
+/** @brief Reads the size and modification time used to detect a stale table. */
+bool sourceStamp(const std::filesystem::path& jsonPath, std::uint64_t& size, std::int64_t& time) {
+    std::error_code ec;
+    size = std::filesystem::file_size(jsonPath, ec);
+    if (ec)
+        return false;
+    auto written = std::filesystem::last_write_time(jsonPath, ec);
+    if (ec)
+        return false;
+    time = static_cast<std::int64_t>(written.time_since_epoch().count());
+    return true;
+}
+
+/** @brief Appends a string to the blob and returns its offset. */
+std::uint32_t appendString(std::string& blob, const std::string& text) {
+    std::uint32_t offset = static_cast<std::uint32_t>(blob.size());
+    blob += text;
+    return offset;
+}
+
+} // namespace
+
+bool CardDatabase::compile(const std::filesystem::path& jsonPath, const std::filesystem::path& dbPath,
+                           std::string& error) {
+    Header header{};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    if (!sourceStamp(jsonPath, header.sourceSize, header.sourceTime)) {
+        error = "cannot stat " + jsonPath.string();
+        return false;
+    }
+
+    std::ifstream file(jsonPath);
+    if (!file.is_open()) {
+        error = "cannot open " + jsonPath.string();
+        return false;
+    }
+
+    std::vector<CardRecord> cards;
+    std::vector<InstructionRecord> instructions;
+    std::vector<ResourceRecord> resources;
+    std::unordered_map<ResourceId, std::uint16_t> resourceIndex;
+    std::string blob;
+
+    std::string parseError;
+    bool parsed = CardJsonReader::read(file, [&](const nlohmann::json& cardData) {
+        // Reuse the runtime compiler so both loaders produce identical definitions
+        CardDefinition definition(cardData);
+
+        CardRecord record{};
+        record.nameLength = static_cast<std::uint32_t>(definition.name.size());
+        record.nameOffset = appendString(blob, definition.name);
+        record.descriptionLength = static_cast<std::uint32_t>(definition.description.size());
+        record.descriptionOffset = appendString(blob, definition.description);
+        record.copies = 1;
+        if (cardData.contains("copies") && cardData["copies"].is_number_integer())
+            record.copies = static_cast<std::uint32_t>(std::max(0, cardData["copies"].get<int>()));
+        record.firstInstruction = static_cast<std::uint32_t>(instructions.size());
+        for (std::size_t t = 0; t <= CARD_TRIGGER_COUNT; ++t)
+            record.triggerStart[t] = definition.triggerStart[t];
+        cards.push_back(record);
+
+        for (const CardInstruction& instruction : definition.code) {
+            auto [it, inserted] = resourceIndex.try_emplace(instruction.resource,
+                                                            static_cast<std::uint16_t>(resources.size()));
+            if (inserted) {
+                const std::string& name = Resources::toString(instruction.resource);
+                resources.push_back({appendString(blob, name), static_cast<std::uint32_t>(name.size())});
+            }
+            instructions.push_back({static_cast<std::uint8_t>(instruction.op), 0, it->second,
+                                    static_cast<std::int32_t>(instruction.amount)});
+        }
+    }, parseError);
+    if (!parsed) {
+        error = "error parsing " + jsonPath.string() + ": " + parseError;
+        return false;
+    }
+
+    header.cardCount = static_cast<std::uint32_t>(cards.size());
+    header.instructionCount = static_cast<std::uint32_t>(instructions.size());
+    header.resourceCount = static_cast<std::uint32_t>(resources.size());
+    header.stringBytes = static_cast<std::uint32_t>(blob.size());
+
+    // Write beside the destination, then rename, so readers never see a partial table
+    std::filesystem::path tempPath = dbPath;
+    tempPath += ".tmp";
+    {
+        std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            error = "cannot write " + tempPath.string();
+            return false;
+        }
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(cards.data()), cards.size() * sizeof(CardRecord));
+        out.write(reinterpret_cast<const char*>(instructions.data()), instructions.size() * sizeof(InstructionRecord));
+        out.write(reinterpret_cast<const char*>(resources.data()), resources.size() * sizeof(ResourceRecord));
+        out.write(blob.data(), blob.size());
+        if (!out) {
+            error = "error writing " + tempPath.string();
+            return false;
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tempPath, dbPath, ec);
+    if (ec) {
+        error = "cannot replace " + dbPath.string() + ": " + ec.message();
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @details
+ * Every count and offset is bounds-checked against the mapped size before use, so a
+ * truncated or foreign file is rejected rather than read past its end. The whole table
+ * is decoded and validated before any resource is interned or any card registered, so
+ * a rejected table leaves the registry exactly as it was for the JSON fallback.
+ */
+bool CardDatabase::load(const std::filesystem::path& dbPath, const std::filesystem::path& jsonPath,
+                        CardRegistry& registry, std::vector<Entry>& entries) {
+    MappedFile mapped(dbPath);
+    if (!mapped.begin() || mapped.size() < sizeof(Header))
+        return false;
+
+    Header header;
+    std::memcpy(&header, mapped.begin(), sizeof(header));
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION)
+        return false;
+
+    std::uint64_t jsonSize = 0;
+    std::int64_t jsonTime = 0;
+    if (std::filesystem::exists(jsonPath) &&
+        (!sourceStamp(jsonPath, jsonSize, jsonTime) || jsonSize != header.sourceSize || jsonTime != header.sourceTime))
+        return false;
+
+    const std::size_t expected = sizeof(Header) +
+                                 std::size_t(header.cardCount) * sizeof(CardRecord) +
+                                 std::size_t(header.instructionCount) * sizeof(InstructionRecord) +
+                                 std::size_t(header.resourceCount) * sizeof(ResourceRecord) +
+                                 header.stringBytes;
+    if (mapped.size() != expected)
+        return false;
+
+    // Records are read in place from the mapping; memcpy keeps the reads alignment-safe
+    const char* cursor = mapped.begin() + sizeof(Header);
+    const char* cardBase = cursor;
+    const char* instructionBase = cardBase + std::size_t(header.cardCount) * sizeof(CardRecord);
+    const char* resourceBase = instructionBase + std::size_t(header.instructionCount) * sizeof(InstructionRecord);
+    const char* strings = resourceBase + std::size_t(header.resourceCount) * sizeof(ResourceRecord);
+
+    auto inBlob = [&](std::uint32_t offset, std::uint32_t length) {
+        return std::uint64_t(offset) + length <= header.stringBytes;
+    };
+
+    std::vector<ResourceRecord> resources(header.resourceCount);
+    for (std::uint32_t i = 0; i < header.resourceCount; ++i) {
+        std::memcpy(&resources[i], resourceBase + i * sizeof(ResourceRecord), sizeof(ResourceRecord));
+        if (!inBlob(resources[i].nameOffset, resources[i].nameLength))
+            return false;
+    }
+
+    std::vector<CardRecord> records(header.cardCount);
+    for (std::uint32_t i = 0; i < header.cardCount; ++i) {
+        CardRecord& record = records[i];
+        std::memcpy(&record, cardBase + i * sizeof(CardRecord), sizeof(record));
+        const std::uint32_t codeLength = record.triggerStart[CARD_TRIGGER_COUNT];
+        if (!inBlob(record.nameOffset, record.nameLength) ||
+            !inBlob(record.descriptionOffset, record.descriptionLength) ||
+            std::uint64_t(record.firstInstruction) + codeLength > header.instructionCount)
+            return false;
+        for (std::size_t t = 0; t <= CARD_TRIGGER_COUNT; ++t) {
+            if (record.triggerStart[t] > codeLength || (t > 0 && record.triggerStart[t] < record.triggerStart[t - 1]))
+                return false;
+        }
+    }
+
+    std::vector<InstructionRecord> instructions(header.instructionCount);
+    for (std::uint32_t i = 0; i < header.instructionCount; ++i) {
+        std::memcpy(&instructions[i], instructionBase + i * sizeof(InstructionRecord), sizeof(InstructionRecord));
+        if (instructions[i].resource >= header.resourceCount ||
+            instructions[i].op != static_cast<std::uint8_t>(CardOp::AddResource))
+            return false;
+    }
+
+    // The table is valid; only now touch the process-wide resource names and the registry
+    std::vector<ResourceId> resourceIds(header.resourceCount);
+    for (std::uint32_t i = 0; i < header.resourceCount; ++i)
+        resourceIds[i] = Resources::intern(std::string(strings + resources[i].nameOffset, resources[i].nameLength));
+
+    std::vector<Entry> loaded;
+    loaded.reserve(header.cardCount);
+    for (const CardRecord& record : records) {
+        CardDefinition definition;
+        definition.name.assign(strings + record.nameOffset, record.nameLength);
+        definition.description.assign(strings + record.descriptionOffset, record.descriptionLength);
+        for (std::size_t t = 0; t <= CARD_TRIGGER_COUNT; ++t)
+            definition.triggerStart[t] = record.triggerStart[t];
+
+        definition.code.resize(record.triggerStart[CARD_TRIGGER_COUNT]);
+        for (std::size_t j = 0; j < definition.code.size(); ++j) {
+            const InstructionRecord& op = instructions[record.firstInstruction + j];
+            definition.code[j].op = static_cast<CardOp>(op.op);
+            definition.code[j].resource = resourceIds[op.resource];
+            definition.code[j].amount = op.amount;
+        }
+
+        loaded.push_back({&registry.add(std::move(definition)), static_cast<int>(record.copies)});
+    }
+
+    entries = std::move(loaded);
+    return true;
+}
@@ -0,0 +1,120 @@
+#include "CardJsonReader.hpp"
+#include <exception>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using json = nlohmann::json;
+
+/**
+ * @brief SAX handler that rebuilds one card at a time.
+ *
+ * Depth 0 is outside the file's array and depth 1 is inside it. Anything deeper belongs to
+ * the card being built. The stack holds the containers open inside that card; each one is
+ * the most recently inserted child of the one below it, so the pointers stay valid.
+ */
+class CardSaxHandler : public nlohmann::json_sax<json> {
+public:
+    CardSaxHandler(const CardJsonReader::CardCallback& onCard_, std::string& error_)
+        : onCard(onCard_), error(error_) {}
+
+    bool null() override { return value(json(nullptr)); }
+    bool boolean(bool val) override { return value(json(val)); }
+    bool number_integer(number_integer_t val) override { return value(json(val)); }
+    bool number_unsigned(number_unsigned_t val) override { return value(json(val)); }
+    bool number_float(number_float_t val, const string_t&) override { return value(json(val)); }
+    bool string(string_t& val) override { return value(json(std::move(val))); }
+    bool binary(binary_t& val) override { return value(json(std::move(val))); }
+
+    bool start_object(std::size_t) override {
+        if (depth == 0)
+            return fail("card file must contain an array of cards");
+        if (depth == 1) {
+            card = json::object();
+            stack.push_back(&card);
+        } else {
+            stack.push_back(&insert(json::object()));
+        }
+        ++depth;
+        return true;
+    }
+
+    bool key(string_t& val) override {
+        pendingKey = std::move(val);
+        return true;
+    }
+
+    bool end_object() override { return close(); }
+
+    bool start_array(std::size_t) override {
+        if (depth == 1)
+            return fail("card " + std::to_string(cardCount) + " is not an object");
+        if (depth > 1)
+            stack.push_back(&insert(json::array()));
+        ++depth;
+        return true;
+    }
+
+    bool end_array() override { return close(); }
+
+    bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception& e) override {
+        return fail(e.what());
+    }
+
+private:
+    bool value(json&& val) {
+        if (depth == 0)
+            return fail("card file must contain an array of cards");
+        if (depth == 1)
+            return fail("card " + std::to_string(cardCount) + " is not an object");
+        insert(std::move(val));
+        return true;
+    }
+
+    /** @brief Adds a value to the innermost open container and returns it. */
+    json& insert(json&& val) {
+        json& top = *stack.back();
+        if (top.is_object())
+            return top[pendingKey] = std::move(val);
+        top.push_back(std::move(val));
+        return top.back();
+    }
+
+    bool close() {
+        if (--depth == 0)
+            return true;
+        stack.pop_back();
+        if (depth == 1) {
+            onCard(card);
+            card = nullptr;
+            ++cardCount;
+        }
+        return true;
+    }
+
+    bool fail(const std::string& message) {
+        error = message;
+        return false;
+    }
+
+    const CardJsonReader::CardCallback& onCard;
+    std::string& error;
+    json card;                      ///< Card currently being built.
+    std::vector<json*> stack;       ///< Open containers inside the current card.
+    string_t pendingKey;            ///< Key for the next value inside an object.
+    std::size_t depth = 0;          ///< Nesting depth, counting the file's array.
+    std::size_t cardCount = 0;      ///< Cards completed so far.
+};
+
+} // namespace
+
+bool CardJsonReader::read(std::istream& input, const CardCallback& onCard, std::string& error) {
+    CardSaxHandler handler(onCard, error);
+    try {
+        return json::sax_parse(input, &handler);
+    } catch (const std::exception& e) {
+        error = e.what();
+        return false;
+    }
+}
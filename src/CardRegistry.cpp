@@ -0,0 +1,35 @@
+#include "CardRegistry.hpp"
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+const CardDefinition& CardRegistry::add(CardDefinition definition) {
+    auto it = idsByName.find(definition.name);
+    if (it != idsByName.end())
+        return definitions[it->second];
+
+    // Ids index every per-card table, so one that wrapped would alias another card
+    if (definitions.size() > std::numeric_limits<CardId>::max())
+        throw std::length_error("CardRegistry: too many card definitions");
+    definition.id = static_cast<CardId>(definitions.size());
+    idsByName.emplace(definition.name, definition.id);
+    definitions.push_back(std::move(definition));
+    return definitions.back();
+}
+
+const CardDefinition* CardRegistry::find(const std::string& name) const {
+    auto it = idsByName.find(name);
+    return (it != idsByName.end()) ? &definitions[it->second] : nullptr;
+}
+
+const CardDefinition& CardRegistry::get(CardId id) const {
+    return definitions[id];
+}
+
+Card CardRegistry::makeInstance(const CardDefinition& definition) {
+    return Card(&definition, nextInstanceId++);
+}
+
+std::size_t CardRegistry::size() const {
+    return definitions.size();
+}
@@ -0,0 +1,80 @@
+#include "CardZone.hpp"
+#include <utility>
+
+Card& CardZone::add(Card&& card) {
+    CardId id = card.getId();
+    if (id >= positionsById.size())
+        positionsById.resize(static_cast<std::size_t>(id) + 1);
+
+    auto& positions = positionsById[id];
+    bucketSlot.push_back(static_cast<std::uint32_t>(positions.size()));
+    positions.push_back(static_cast<std::uint32_t>(cards.size()));
+    cards.push_back(std::move(card));
+    return cards.back();
+}
+
+bool CardZone::take(CardId id, Card& out) {
+    if (id >= positionsById.size() || positionsById[id].empty())
+        return false;
+
+    std::size_t position = positionsById[id].back();
+    out = std::move(cards[position]);
+    eraseAt(position);
+    return true;
+}
+
+std::size_t CardZone::removeAll(CardId id) {
+    if (id >= positionsById.size())
+        return 0;
+
+    std::size_t removed = 0;
+    while (!positionsById[id].empty()) {
+        eraseAt(positionsById[id].back());
+        ++removed;
+    }
+    return removed;
+}
+
+std::size_t CardZone::count(CardId id) const {
+    return (id < positionsById.size()) ? positionsById[id].size() : 0;
+}
+
+/** @details Covers the per-id position buckets as well as the card list itself. */
+void CardZone::reserve(const std::vector<std::uint32_t>& copiesById) {
+    std::size_t capacity = 0;
+    for (std::uint32_t copies : copiesById)
+        capacity += copies;
+    cards.reserve(capacity);
+    bucketSlot.reserve(capacity);
+
+    if (positionsById.size() < copiesById.size())
+        positionsById.resize(copiesById.size());
+    for (std::size_t id = 0; id < copiesById.size(); ++id)
+        positionsById[id].reserve(copiesById[id]);
+}
+
+/**
+ * @details
+ * Two fix-ups keep the index exact in O(1): the removed card's bucket entry is
+ * replaced by that bucket's last entry, then the zone's last card moves into the
+ * freed position and its own bucket entry is repointed.
+ */
+void CardZone::eraseAt(std::size_t position) {
+    // Drop the removed card from its id bucket
+    auto& positions = positionsById[cards[position].getId()];
+    std::uint32_t slot = bucketSlot[position];
+    std::uint32_t movedPosition = positions.back();
+    positions[slot] = movedPosition;
+    bucketSlot[movedPosition] = slot;
+    positions.pop_back();
+
+    // Fill the hole with the zone's last card
+    std::size_t last = cards.size() - 1;
+    if (position != last) {
+        cards[position] = std::move(cards[last]);
+        bucketSlot[position] = bucketSlot[last];
+        positionsById[cards[position].getId()][bucketSlot[position]] = static_cast<std::uint32_t>(position);
+    }
+    cards.pop_back();
+    bucketSlot.pop_back();
+}
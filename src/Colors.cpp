@@ -1,6 +1,6 @@
 #include "Colors.hpp"
 
-// Full list of recognized color names.
+// Full list of recognized color names, in ColorId order.
 const std::vector<std::string> Colors::all = {
     "Red", "Yellow", "Blue", "Green", "Purple", "White", "Gray", "Neutral"
 };
@@ -17,27 +17,22 @@ const std::map<std::string, std::string> Colors::colorCodes = {
     {"Neutral", "\033[0m..."}
 };
 
-// SFML color equivalents for in-game rendering.
-const std::map<std::string, sf::Color> Colors::sfmlColors = {
-    {"Red",     sf::Color(0xD9, 0x7B, 0x66)},
-    {"Yellow",  sf::Color(0xE3, 0xC5, 0x67)},
-    {"Blue",    sf::Color(0x6C, 0x8E, 0xBF)},
-    {"Green",   sf::Color(0x7C, 0xA9, 0x82)},
-    {"Purple",  sf::Color(0xA8, 0x8E, 0xC6)},
-    {"White",   sf::Color(0xF2, 0xE9, 0xE4)},
-    {"Gray",    sf::Color(0xB0, 0xA8, 0xB9)},
-    {"Neutral", sf::Color(0x4B, 0x4A, 0x54)}
-};
-
 // Returns true if the color string exists in Colors::all.
 bool Colors::isValid(const std::string& color) {
-    return std::find(all.begin(), all.end(), color) != all.end();
+    ColorId id;
+    return tryParse(color, id);
+}
+
+// Resolves a color name to its ColorId; only used at input boundaries.
+bool Colors::tryParse(const std::string& color, ColorId& id) {
+    auto it = std::find(all.begin(), all.end(), color);
+    if (it == all.end())
+        return false;
+    id = static_cast<ColorId>(it - all.begin());
+    return true;
 }
 
-// Returns the matching SFML color, or Neutral as a fallback.
-const sf::Color& Colors::getSfmlColor(const std::string& color) {
-    auto it = sfmlColors.find(color);
-    if (it != sfmlColors.end())
-        return it->second;
-    return sfmlColors.at("Neutral");
+// Returns the display name of the color.
+const std::string& Colors::toString(ColorId id) {
+    return all[static_cast<size_t>(id)];
 }
@@ -31,6 +31,9 @@ void CommandConsole::draw(sf::RenderWindow& window) {
 
 // Process key events for input, history navigation, and command submission.
 void CommandConsole::handleEvent(const sf::Event& e) {
+    if (e.type == sf::Event::KeyPressed || e.type == sf::Event::TextEntered)
+        dirty = true;
+
     if (e.type == sf::Event::KeyPressed) {
         // ↑ arrow → previous command
         if (e.key.code == sf::Keyboard::Up) {
@@ -80,6 +83,7 @@ void CommandConsole::print(const std::string& line) {
     outputLines.push_back(line);
     if (outputLines.size() > maxLines)
         outputLines.erase(outputLines.begin());
+    dirty = true;
 }
 
 // Begin a new paged output sequence.
@@ -122,4 +126,5 @@ std::string CommandConsole::nextCommand() {
 // Clear all visible console output.
 void CommandConsole::clear() {
     outputLines.clear();
+    dirty = true;
 }
@@ -21,13 +21,17 @@ CubeCoord CubeCoord::operator+(const CubeCoord& other) const {
 /**
  * @brief Generates a hash for a CubeCoord to be used in unordered containers.
  * @param c The coordinate to hash.
- * @return Combined hash value for x, y, z.
+ * @return Mixed hash value of the packed (x, y) key.
  *
- * Combines individual hashes using bit shifting to reduce collisions.
+ * Applies the SplitMix64 finalizer to the packed key, so every input bit
+ * affects every output bit and symmetric coordinates no longer collide.
  */
 std::size_t CubeCoordHash::operator()(const CubeCoord& c) const noexcept {
-    std::size_t h1 = std::hash<int>{}(c.x); ///< Hash x component.
-    std::size_t h2 = std::hash<int>{}(c.y); ///< Hash y component.
-    std::size_t h3 = std::hash<int>{}(c.z); ///< Hash z component.
-    return h1 ^ (h2 << 1) ^ (h3 << 2);      ///< Combine hashes with bit shifts.
+    std::uint64_t h = c.packKey();
+    h ^= h >> 30;
+    h *= 0xBF58476D1CE4E5B9ULL;
+    h ^= h >> 27;
+    h *= 0x94D049BB133111EBULL;
+    h ^= h >> 31;
+    return static_cast<std::size_t>(h);
 }
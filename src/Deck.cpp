@@ -1,53 +1,91 @@
 #include "Deck.hpp"
+#include "CardDatabase.hpp"
+#include "CardJsonReader.hpp"
 #include "PathUtils.hpp"
 #include <fstream>
 #include <nlohmann/json.hpp>
 #include <iostream>
+#include <algorithm>
 #include <random>
+#include <utility>
 
 /**
  * @details
  * Uses PathUtils::getAssetPath() to resolve the full path of the file.
- * Cards are loaded from JSON, supporting an optional "copies" field for duplication.
- * Any parsing or I/O errors are printed to stderr.
+ * Each card definition is compiled and registered once; the optional "copies" field
+ * only controls how many handles to it are added.
+ * The file is streamed through CardJsonReader, so the full JSON document is never built.
+ * Any parsing or I/O errors are printed to stderr, and the deck is left unchanged.
  */
-void Deck::loadFromJsonFile(const std::string& filename) {
+std::size_t Deck::loadFromJsonFile(const std::string& filename, CardRegistry& registry) {
     std::filesystem::path path = PathUtils::getAssetPath(filename);
 
     if (!std::filesystem::exists(path)) {
         std::cerr << "Error: Could not find " << path << "\n";
-        return;
+        return 0;
     }
 
     std::ifstream file(path);
     if (!file.is_open()) {
         std::cerr << "Error: Could not open " << path << "\n";
-        return;
-    }
-
-    nlohmann::json data;
-    try {
-        file >> data;
-    } catch (const std::exception& e) {
-        std::cerr << "Error parsing JSON from " << path << ": " << e.what() << "\n";
-        return;
+        return 0;
     }
 
-    cards.clear();
-
-    /** @note Default copies = 1 unless explicitly defined in JSON. */
-    for (const auto& cardData : data) {
+    // Stream the file so only one card's JSON is held in memory at a time
+    std::vector<Card> loaded;
+    std::string error;
+    bool ok = CardJsonReader::read(file, [&](const nlohmann::json& cardData) {
+        /** @note Default copies = 1 unless explicitly defined in JSON. */
         int copies = 1;
         if (cardData.contains("copies") && cardData["copies"].is_number_integer()) {
             copies = cardData["copies"];
         }
 
+        const CardDefinition& definition = registry.add(CardDefinition(cardData));
         for (int i = 0; i < copies; ++i) {
-            cards.emplace_back(cardData);
+            loaded.push_back(registry.makeInstance(definition));
         }
+    }, error);
+
+    if (!ok) {
+        std::cerr << "Error parsing JSON from " << path << ": " << error << "\n";
+        return 0;
     }
 
-    std::cout << "Loaded " << cards.size() << " cards from " << path << "\n";
+    cards = std::move(loaded);
+    return cards.size();
+}
+
+/**
+ * @details
+ * A stale or unreadable binary table is not an error: it just means the JSON is
+ * authoritative until spotlight_cardc is run again. A rejected table leaves the
+ * registry untouched, so the next candidate or the JSON loader starts clean.
+ */
+std::size_t Deck::loadCardPool(const std::string& filename, CardRegistry& registry) {
+    std::filesystem::path jsonPath = PathUtils::getAssetPath(filename);
+    std::filesystem::path dbName = std::filesystem::path(filename).replace_extension(".bin");
+
+    // A table placed beside the JSON wins over the one generated by the build
+    std::vector<std::filesystem::path> dbPaths{PathUtils::getAssetPath(dbName.string())};
+#ifdef SPOTLIGHT_GENERATED_ASSET_DIR
+    dbPaths.push_back(std::filesystem::path(SPOTLIGHT_GENERATED_ASSET_DIR) / dbName);
+#endif
+
+    std::vector<CardDatabase::Entry> entries;
+    auto loaded = std::find_if(dbPaths.begin(), dbPaths.end(), [&](const std::filesystem::path& dbPath) {
+        return CardDatabase::load(dbPath, jsonPath, registry, entries);
+    });
+    if (loaded == dbPaths.end())
+        return loadFromJsonFile(filename, registry);
+
+    cards.clear();
+    for (const CardDatabase::Entry& entry : entries) {
+        for (int i = 0; i < entry.copies; ++i) {
+            cards.push_back(registry.makeInstance(*entry.definition));
+        }
+    }
+    return cards.size();
 }
 
 /** @brief Adds a card directly to the deck vector. */
@@ -55,40 +93,91 @@ void Deck::addCard(const Card& card){
     cards.push_back(card);
 }
 
+/** @brief Appends a card handed over by the caller. */
+void Deck::put(Card&& card) {
+    cards.push_back(std::move(card));
+}
+
 /**
  * @details
- * Returns the last element of the vector to simulate drawing from the top.
+ * Moves the last element out of the vector to simulate drawing from the top.
  * Logs an error if called on an empty deck and returns a default card.
  */
-Card Deck::drawCard() {
+Card Deck::take() {
     if (cards.empty()) {
         std::cerr << "Error: Attempted to draw a card from an empty deck ('" << name << "').\n";
         return Card();
     }
 
-    Card card = cards.back();
+    Card card = std::move(cards.back());
     cards.pop_back();
     return card;
 }
 
+/** @brief Forwards to take(). */
+Card Deck::drawCard() {
+    return take();
+}
+
 /**
  * @details
- * Only appends the card to the destination deck — it does not remove it locally.
- * This enables flexible gameplay behavior (e.g., cloning, discarding).
+ * Swaps a random card with the last one and pops it, so the remaining cards stay
+ * contiguous and nothing is shifted.
  */
-void Deck::moveCardTo(const Card& card, Deck& deck) {
-    deck.addCard(card);
+Card Deck::takeRandom(Rng& gen) {
+    if (cards.empty()) {
+        std::cerr << "Error: Attempted to draw a card from an empty deck ('" << name << "').\n";
+        return Card();
+    }
+
+    std::uniform_int_distribution<std::size_t> pick(0, cards.size() - 1);
+    std::swap(cards[pick(gen)], cards.back());
+    Card card = std::move(cards.back());
+    cards.pop_back();
+    return card;
+}
+
+/** @brief Forwards to takeRandom() while the deck is unshuffled, otherwise to take(). */
+Card Deck::draw(Rng& gen) {
+    return unshuffled ? takeRandom(gen) : take();
+}
+
+/** @brief Moves the last card onto the destination deck. */
+bool Deck::moveCardTo(Deck& deck) {
+    if (cards.empty())
+        return false;
+
+    deck.put(std::move(cards.back()));
+    cards.pop_back();
+    return true;
+}
+
+/** @details Swaps buffers when this deck is empty; otherwise appends and clears the source. */
+void Deck::refillFrom(Deck& discard) {
+    unshuffled = true;
+    if (cards.empty()) {
+        cards.swap(discard.cards);
+        return;
+    }
+
+    cards.insert(cards.end(), discard.cards.begin(), discard.cards.end());
+    discard.cards.clear();
 }
 
 /**
  * @details
- * Uses std::shuffle with Mersenne Twister (mt19937) seeded from random_device.
- * Ensures fair shuffling each time it’s called.
+ * Uses std::shuffle with a thread-local Mersenne Twister. The generator is seeded
+ * from random_device on first use only, so repeated shuffles cost no syscalls.
  */
 void Deck::shuffle() {
-    std::random_device rd;
-    std::mt19937 g(rd());
-    std::shuffle(cards.begin(), cards.end(), g);
+    thread_local Rng fallback(RngEngine::Mt19937, Rng::deviceSeed());
+    shuffle(fallback);
+}
+
+/** @brief Shuffles with the supplied engine; deterministic for a given engine state. */
+void Deck::shuffle(Rng& gen) {
+    std::shuffle(cards.begin(), cards.end(), gen);
+    unshuffled = false;
 }
 
 /** @brief Returns the current card count in the deck. */
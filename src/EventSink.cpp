@@ -0,0 +1,129 @@
+#include "EventSink.hpp"
+#include <algorithm>
+#include "Colors.hpp"
+#include "Player.hpp"
+
+EventVerbosity GameEvent::verbosity() const {
+    switch (type) {
+    case GameEventType::ResourceGained:
+    case GameEventType::CardDrawn:
+        return EventVerbosity::Detail;
+    case GameEventType::DailyIncome:
+    case GameEventType::CardPlayed:
+    case GameEventType::TileBuilt:
+        return EventVerbosity::Summary;
+    }
+    return EventVerbosity::Detail;
+}
+
+int EventSink::subscribe(EventVerbosity verbosity, Subscriber subscriber) {
+    int handle = nextHandle++;
+    subscriptions.push_back({handle, verbosity, std::move(subscriber)});
+    refreshMaxVerbosity();
+    return handle;
+}
+
+int EventSink::subscribeStream(std::ostream& out, EventVerbosity verbosity) {
+    return subscribe(verbosity, [&out](const GameEvent& event) {
+        out << describe(event) << '\n';
+    });
+}
+
+void EventSink::setVerbosity(int handle, EventVerbosity verbosity) {
+    for (auto& subscription : subscriptions) {
+        if (subscription.handle == handle)
+            subscription.verbosity = verbosity;
+    }
+    refreshMaxVerbosity();
+}
+
+void EventSink::unsubscribe(int handle) {
+    subscriptions.erase(std::remove_if(subscriptions.begin(), subscriptions.end(),
+                                       [&](const Subscription& s) { return s.handle == handle; }),
+                        subscriptions.end());
+    refreshMaxVerbosity();
+}
+
+std::vector<GameEvent> EventSink::recent() const {
+    if (history.size() < HISTORY_CAPACITY)
+        return history;
+
+    // Full ring: the slot written next holds the oldest event
+    std::vector<GameEvent> ordered(history.begin() + historyNext, history.end());
+    ordered.insert(ordered.end(), history.begin(), history.begin() + historyNext);
+    return ordered;
+}
+
+std::string EventSink::describe(const GameEvent& event) {
+    const std::string& playerName = event.player ? event.player->name : std::string();
+    const std::string& cardName = event.card ? event.card->name : std::string();
+
+    switch (event.type) {
+    case GameEventType::ResourceGained:
+        return playerName + " gains " + std::to_string(event.amount) + " " + Resources::toString(event.resource) +
+               " from " + cardName + " (" + CardDefinition::triggerName(event.trigger) + ")";
+    case GameEventType::DailyIncome:
+        return playerName + " gains " + std::to_string(event.amount) + " " + Resources::toString(event.resource) +
+               " at the start of the day.";
+    case GameEventType::CardDrawn:
+        return playerName + " drew a card: " + cardName;
+    case GameEventType::CardPlayed:
+        return playerName + " played card: " + cardName;
+    case GameEventType::TileBuilt: {
+        std::string company = (event.player && event.player->company) ? event.player->company->getName() : "None";
+        return playerName + " (" + company + ") built a " + Colors::toString(event.color) + " stage at (" +
+               std::to_string(event.tile.x) + ", " + std::to_string(event.tile.y) + ", " +
+               std::to_string(event.tile.z) + ")";
+    }
+    }
+    return std::string();
+}
+
+bool EventSink::tryParseVerbosity(const std::string& name, EventVerbosity& out) {
+    if (name == "off") {
+        out = EventVerbosity::Off;
+        return true;
+    }
+    if (name == "summary") {
+        out = EventVerbosity::Summary;
+        return true;
+    }
+    if (name == "detail") {
+        out = EventVerbosity::Detail;
+        return true;
+    }
+    return false;
+}
+
+const char* EventSink::verbosityName(EventVerbosity verbosity) {
+    switch (verbosity) {
+    case EventVerbosity::Off:
+        return "off";
+    case EventVerbosity::Summary:
+        return "summary";
+    case EventVerbosity::Detail:
+        return "detail";
+    }
+    return "detail";
+}
+
+void EventSink::record(const GameEvent& event) {
+    if (history.size() < HISTORY_CAPACITY) {
+        history.push_back(event);
+    } else {
+        history[historyNext] = event;
+    }
+    historyNext = (historyNext + 1) % HISTORY_CAPACITY;
+
+    const EventVerbosity level = event.verbosity();
+    for (const auto& subscription : subscriptions) {
+        if (level <= subscription.verbosity)
+            subscription.callback(event);
+    }
+}
+
+void EventSink::refreshMaxVerbosity() {
+    maxVerbosity = EventVerbosity::Off;
+    for (const auto& subscription : subscriptions)
+        maxVerbosity = std::max(maxVerbosity, subscription.verbosity);
+}
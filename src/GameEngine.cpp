@@ -0,0 +1,888 @@
+#include "GameEngine.hpp"
+#include <algorithm>
+#include <iostream>
+#include <vector>
+#include <string>
+#include <sstream>
+
+#include "Colors.hpp"
+#include "PathUtils.hpp"
+#include "Resources.hpp"
+
+// Offset of 1 excludes the "Neutral" color (last ColorId) from random selection during setup
+constexpr size_t NEUTRAL_COLOR_OFFSET = 1;
+
+GameEngine::GameEngine(int boardSize, std::vector<Company> companyList)
+    : board(boardSize),
+      currentDay(0),
+      currentTimeOfDay(TimeOfDay::Daybreak),
+      currentActivePlayerIndex(0),
+      rng(RngEngine::Mt19937, Rng::deviceSeed())
+{
+    companies = companyList;
+
+    // Gameplay events reach the player through the same output hook as command replies
+    consoleSubscription = events.subscribe(consoleVerbosity, [this](const GameEvent& event) {
+        print(EventSink::describe(event));
+    });
+    
+    initializeCommandHandlers();
+}
+
+void GameEngine::addPlayer(const std::string& name, Company* company) {
+    players.emplace_back(name, company);
+}
+
+void GameEngine::setup() {
+    // Exclude neutral color (last ColorId) by subtracting offset from distribution range
+    std::uniform_int_distribution<> colorDist(0, COLOR_COUNT - NEUTRAL_COLOR_OFFSET - 1);
+    std::uniform_int_distribution<> ownerDist(0, static_cast<int>(players.size()) - 1);
+
+    // Collect all tile indices for random shuffling
+    std::vector<size_t> tileOrder(board.tileCount());
+    for (size_t i = 0; i < tileOrder.size(); ++i) {
+        tileOrder[i] = i;
+    }
+
+    std::shuffle(tileOrder.begin(), tileOrder.end(), rng);
+
+    // Assign random colors and owners to first half of tiles
+    size_t half = tileOrder.size() / 2;
+    for (size_t i = 0; i < half; ++i) {
+        board.setTileColor(tileOrder[i], static_cast<ColorId>(colorDist(rng)));
+        board.setTileOwner(tileOrder[i], players[ownerDist(rng)].company);
+    }
+
+    // Set remaining tiles to neutral (unowned)
+    for (size_t i = half; i < tileOrder.size(); ++i) {
+        board.setTileColor(tileOrder[i], ColorId::Neutral);
+        board.setTileOwner(tileOrder[i], nullptr);
+    }
+
+    startOfDayBatch.clear();
+
+    // Initialize card decks from JSON configuration
+    // Build the draw deck from the process-wide catalog instead of re-reading the file
+    cardCatalog = CardCatalog::get("cards.json");
+    Deck drawDeck("drawDeck");
+    cardCatalog->fillDeck(drawDeck);
+    // Size every hand and play area for the whole pool, so moving cards between them never allocates
+    for (Player& player : players) {
+        cardCatalog->reserveZone(player.heldCards);
+        cardCatalog->reserveZone(player.playedCards);
+    }
+    if (!quiet)
+        print("Loaded " + std::to_string(drawDeck.size()) + " cards from cards.json");
+    drawDeck.shuffle(rng);
+
+    Deck discardDeck("discardDeck");
+
+    decks.push_back(std::move(drawDeck));
+    decks.push_back(std::move(discardDeck));
+
+    // Deal starting card to first player
+    if (!getDeckByName("drawDeck")->empty()) {
+        players[0].receive(getDeckByName("drawDeck")->take());
+    }
+}
+
+void GameEngine::setQuiet(bool isQuiet) {
+    quiet = isQuiet;
+    events.setVerbosity(consoleSubscription, quiet ? EventVerbosity::Off : consoleVerbosity);
+}
+
+void GameEngine::setEventVerbosity(EventVerbosity verbosity) {
+    consoleVerbosity = verbosity;
+    if (!quiet)
+        events.setVerbosity(consoleSubscription, consoleVerbosity);
+}
+
+EventSink& GameEngine::getEvents() {
+    return events;
+}
+
+void GameEngine::setSeed(std::uint64_t seed) {
+    rng.seed(seed);
+}
+
+void GameEngine::setRngEngine(RngEngine engine) {
+    rng.setEngine(engine);
+}
+
+const Rng& GameEngine::getRng() const {
+    return rng;
+}
+
+const Board& GameEngine::getBoard() const {
+    return board;
+}
+
+const CardRegistry& GameEngine::getCardRegistry() const {
+    static const CardRegistry emptyRegistry;
+    return cardCatalog ? cardCatalog->getRegistry() : emptyRegistry;
+}
+
+void GameEngine::print(const std::string& line) {
+    if (!quiet)
+        std::cout << line << "\n";
+}
+
+void GameEngine::printPaged(const std::vector<std::string>& lines) {
+    // Without a console there is no page to wait on; emit everything at once
+    for (const auto& line : lines)
+        print(line);
+}
+
+Deck* GameEngine::getDeckByName(const std::string& deckName) {
+    for (auto& deck : decks) {
+        if (deck.name == deckName)
+            return &deck;
+    }
+    std::cerr << "Error: Deck '" << deckName << "' not found.\n";
+    return nullptr;
+}
+
+const std::vector<Player>& GameEngine::getPlayers() const {
+    return players;
+}
+
+int GameEngine::getCurrentActivePlayerIndex() {
+    return currentActivePlayerIndex;
+}
+
+int GameEngine::getCurrentDay() {
+    return currentDay;
+}
+
+TimeOfDay GameEngine::getCurrentTimeOfDay() const {
+    return currentTimeOfDay;
+}
+
+void GameEngine::advanceTimeOfDay(bool logToConsole) {
+    // Advance to next time period
+    int nextTime = static_cast<int>(currentTimeOfDay) + 1;
+    
+    // Wrap back to Daybreak if past Nightfall
+    if (nextTime > static_cast<int>(TimeOfDay::Nightfall)) {
+        currentTimeOfDay = TimeOfDay::Daybreak;
+    } else {
+        currentTimeOfDay = static_cast<TimeOfDay>(nextTime);
+    }
+    
+    if (logToConsole) {
+        print("Time advanced to " + getTimeOfDayString(currentTimeOfDay));
+    }
+}
+
+std::string GameEngine::getTimeOfDayString(TimeOfDay time) {
+    switch (time) {
+        case TimeOfDay::Daybreak:   return "Daybreak";
+        case TimeOfDay::Morning:    return "Morning";
+        case TimeOfDay::Afternoon:  return "Afternoon";
+        case TimeOfDay::Evening:    return "Evening";
+        case TimeOfDay::Nightfall:  return "Nightfall";
+        default:                    return "Unknown";
+    }
+}
+
+void GameEngine::restrictCommandToTimes(const std::string& commandName, const std::vector<TimeOfDay>& allowedTimes) {
+    commandTimeRestrictions[commandName] = allowedTimes;
+}
+
+bool GameEngine::isCommandAllowedAtCurrentTime(const std::string& commandName) const {
+    auto it = commandTimeRestrictions.find(commandName);
+    
+    // If command not in restriction map, it's always allowed
+    if (it == commandTimeRestrictions.end()) {
+        return true;
+    }
+    
+    // Check if current time is in the allowed list
+    const auto& allowedTimes = it->second;
+    return std::find(allowedTimes.begin(), allowedTimes.end(), currentTimeOfDay) != allowedTimes.end();
+}
+
+void GameEngine::startNewDay() {
+    // Evaluate every persistent card effect in one pass, then apply each player's net change
+    dayDeltas.resize(players.size());
+    startOfDayBatch.collect(dayDeltas);
+
+    for (size_t i = 0; i < players.size(); ++i) {
+        const ResourceDelta& delta = dayDeltas[i];
+        if (delta.empty())
+            continue;
+
+        Player& player = players[i];
+        auto apply = [&](ResourceId resource, int amount) {
+            if (amount == 0)
+                return;
+            player.addResource(resource, amount);
+
+            GameEvent event;
+            event.type = GameEventType::DailyIncome;
+            event.resource = resource;
+            event.amount = amount;
+            event.player = &player;
+            events.emit(event);
+        };
+
+        for (size_t r = 0; r < KNOWN_RESOURCE_COUNT; ++r)
+            apply(static_cast<ResourceId>(r), delta.known[r]);
+        for (const auto& [resource, amount] : delta.extra)
+            apply(resource, amount);
+    }
+}
+
+void GameEngine::drawCardForPlayer(Deck& deck, Player& player, int amount) {
+    // An exhausted draw pile is replenished from the discard pile without copying. It is
+    // not reshuffled: draw() below picks the refilled cards at random instead
+    if (deck.empty() && deck.name != "discardDeck") {
+        Deck* discardDeck = getDeckByName("discardDeck");
+        if (discardDeck && !discardDeck->empty())
+            deck.refillFrom(*discardDeck);
+    }
+
+    if (deck.empty()) {
+        print("The deck is empty! No more cards to draw.");
+        return;
+    }
+
+    // Draw up to 'amount' cards, stopping if deck exhausted
+    for (int i = 0; i < amount && !deck.empty(); ++i) {
+        player.receive(deck.draw(rng));
+
+        GameEvent event;
+        event.type = GameEventType::CardDrawn;
+        event.player = &player;
+        event.card = player.heldCards.back().getDefinition();
+        events.emit(event);
+    }
+}
+
+void GameEngine::giveResourceToPlayer(int playerIndex, ResourceId resource, int amount, bool logToConsole) {
+    if (!validateAndSetPlayerIndex(playerIndex, logToConsole))
+        return;
+
+    Player& player = players[playerIndex];
+    player.addResource(resource, amount);
+
+    if (logToConsole)
+        print("Gave " + std::to_string(amount) + " " + Resources::toString(resource) + " to " + player.name + ".");
+}
+
+bool GameEngine::spendResourceFromPlayer(int playerIndex, ResourceId resource, int amount, bool logToConsole) {
+    if (!validateAndSetPlayerIndex(playerIndex, logToConsole))
+        return false;
+
+    Player& player = players[playerIndex];
+
+    // Validate sufficient resources before deducting
+    if (!player.spendResource(resource, amount)) {
+        if (logToConsole)
+            print("Error: Not enough " + Resources::toString(resource) + " for " + player.name + ".");
+        return false;
+    }
+
+    if (logToConsole)
+        print(player.name + " spent " + std::to_string(amount) + " " + Resources::toString(resource) + ".");
+    return true;
+}
+
+std::size_t GameEngine::buildStage(int playerIndex, int x, int y, int z, ColorId color) {
+    Player& activePlayer = players[playerIndex];
+
+    board.setTileOwner(x, y, z, activePlayer.company);
+    board.setTileColor(x, y, z, color);
+
+    GameEvent event;
+    event.type = GameEventType::TileBuilt;
+    event.player = &activePlayer;
+    event.color = color;
+    event.tile = CubeCoord(x, y, z);
+    events.emit(event);
+
+    // Region trackers merge the new tile on write, so this lookup is near-constant time
+    return board.getTerritorySize(CubeCoord(x, y, z));
+}
+
+bool GameEngine::playCardForPlayer(int playerIndex, const std::string& cardName, bool logToConsole) {
+    if (!validateAndSetPlayerIndex(playerIndex, logToConsole))
+        return false;
+
+    Player& player = players[playerIndex];
+    const CardDefinition* definition = getCardRegistry().find(cardName);
+    Card* played = definition ? player.playFromHand(definition->id) : nullptr;
+    if (played) {
+        // Execute the immediate effect, then register any effect that repeats each day
+        played->executeTrigger(CardTrigger::OnPlay, player, &events);
+        startOfDayBatch.subscribe(playerIndex, *definition);
+
+        GameEvent event;
+        event.type = GameEventType::CardPlayed;
+        event.player = &player;
+        event.card = definition;
+        events.emit(event);
+        return true;
+    } else {
+        if (logToConsole)
+            print("Error: " + player.name + " does not have card '" + cardName + "' in hand.");
+        return false;
+    }
+}
+
+bool GameEngine::removePlayedCardForPlayer(int playerIndex, const std::string& cardName, bool logToConsole) {
+    if (!validateAndSetPlayerIndex(playerIndex, logToConsole))
+        return false;
+
+    Player& player = players[playerIndex];
+    const CardDefinition* definition = getCardRegistry().find(cardName);
+    if (definition && player.removePlayedCard(definition->id, getDeckByName("discardDeck"))) {
+        startOfDayBatch.unsubscribeAll(playerIndex, definition->id);
+        if (logToConsole)
+            print("Removed played card '" + cardName + "' from " + player.name);
+        return true;
+    } else {
+        if (logToConsole)
+            print("Error: " + player.name + " does not have card '" + cardName + "' in play.");
+        return false;
+    }
+}
+
+bool GameEngine::removeHeldCardForPlayer(int playerIndex, const std::string& cardName, bool logToConsole) {
+    if (!validateAndSetPlayerIndex(playerIndex, logToConsole))
+        return false;
+
+    Player& player = players[playerIndex];
+    const CardDefinition* definition = getCardRegistry().find(cardName);
+    if (definition && player.removeHeldCard(definition->id, getDeckByName("discardDeck"))) {
+        if (logToConsole)
+            print("Removed card '" + cardName + "' from " + player.name + "'s hand.");
+        return true;
+    } else {
+        if (logToConsole)
+            print("Error: " + player.name + " does not have card '" + cardName + "' in hand.");
+        return false;
+    }
+}
+
+void GameEngine::endTurn(bool logToConsole) {
+    print(players[currentActivePlayerIndex].name + " ended their turn.");
+    currentActivePlayerIndex++;
+    
+    // Wrap around to first player after last player finishes turn
+    if (currentActivePlayerIndex > players.size() - 1) {
+        currentActivePlayerIndex = 0;
+        currentDay++;
+        if (logToConsole)
+            print("Last player finished turn. Starting day: " + std::to_string(currentDay));
+        startNewDay();
+    }
+    
+    print(players[currentActivePlayerIndex].name + " starts their turn.");
+}
+
+bool GameEngine::validateAndSetPlayerIndex(int& playerIndex, bool logToConsole) {
+    // Convention: -1 represents the current active player
+    if (playerIndex == -1)
+        playerIndex = getCurrentActivePlayerIndex();
+    
+    // Bounds checking for player roster
+    if (playerIndex < 0 || playerIndex >= players.size()) {
+        if (logToConsole)
+            print("Error: Player index " + std::to_string(playerIndex) +
+                  " is out of range. Max valid index: " + std::to_string(players.size() - 1));
+        return false;
+    }
+    return true;
+}
+
+bool GameEngine::parseCardNameWithOptionalPlayerIndex(std::istringstream& ss, std::string& cardName, int& playerIndex) {
+    cardName.clear();
+    playerIndex = -1;
+    
+    // Tokenize entire remaining input
+    std::vector<std::string> tokens;
+    std::string token;
+    while (ss >> token) {
+        tokens.push_back(token);
+    }
+    
+    if (tokens.empty()) {
+        return false;
+    }
+    
+    // Check if last token is numeric (player index)
+    // This creates ambiguity for card names ending in numbers
+    bool hasPlayerIndex = false;
+    if (!tokens.empty()) {
+        try {
+            playerIndex = std::stoi(tokens.back());
+            hasPlayerIndex = true;
+            tokens.pop_back();
+        } catch (...) {
+            // Last token is not a number, treat as part of card name
+        }
+    }
+    
+    // Reconstruct card name from remaining tokens (handles multi-word names)
+    for (size_t i = 0; i < tokens.size(); ++i) {
+        if (i > 0) cardName += " ";
+        cardName += tokens[i];
+    }
+    
+    if (cardName.empty()) {
+        return false;
+    }
+    
+    if (!hasPlayerIndex) {
+        playerIndex = -1;
+    }
+    
+    return true;
+}
+
+void GameEngine::initializeCommandHandlers() {
+    // Register command: "end_turn" - Advance turn to next player
+    commandHandlers["end_turn"] = [this](std::istringstream&) {
+        endTurn(true);
+    };
+
+    // Register command: "set_color" - Directly change tile color
+    commandHandlers["set_color"] = [this](std::istringstream& ss) {
+        handleSetColor(ss);
+    };
+
+    // Register command: "set_owner" - Directly assign tile ownership
+    commandHandlers["set_owner"] = [this](std::istringstream& ss) {
+        handleSetOwner(ss);
+    };
+
+    // Register command: "build" - Player constructs a stage on a tile
+    commandHandlers["build"] = [this](std::istringstream& ss) {
+        handleBuild(ss);
+    };
+
+    // Register command: "show_territory" - Display player's largest contiguous territory
+    commandHandlers["show_territory"] = [this](std::istringstream& ss) {
+        handleShowTerritory(ss);
+    };
+
+    // Register command: "list_players" - Display all player names and companies
+    commandHandlers["list_players"] = [this](std::istringstream&) {
+        handleListPlayers();
+    };
+
+    // Register command: "show_resources" - Display player's resource inventory
+    commandHandlers["show_resources"] = [this](std::istringstream& ss) {
+        handleShowResources(ss);
+    };
+
+    // Register command: "show_cards" - Display player's hand
+    commandHandlers["show_cards"] = [this](std::istringstream& ss) {
+        handleShowCards(ss);
+    };
+
+    // Register command: "get_card_count" - Query remaining cards in a deck
+    commandHandlers["get_card_count"] = [this](std::istringstream& ss) {
+        handleGetCardCount(ss);
+    };
+
+    // Register command: "draw_card" - Draw cards from deck to player hand
+    commandHandlers["draw_card"] = [this](std::istringstream& ss) {
+        handleDrawCard(ss);
+    };
+
+    // Register command: "give_resource" - Grant resources to player
+    commandHandlers["give_resource"] = [this](std::istringstream& ss) {
+        handleGiveResource(ss);
+    };
+
+    // Register command: "spend_resource" - Deduct resources from player
+    commandHandlers["spend_resource"] = [this](std::istringstream& ss) {
+        handleSpendResource(ss);
+    };
+
+    // Register command: "play_card" - Play card from hand
+    commandHandlers["play_card"] = [this](std::istringstream& ss) {
+        handlePlayCard(ss);
+    };
+
+    // Register command: "remove_played_card" - Discard active card
+    commandHandlers["remove_played_card"] = [this](std::istringstream& ss) {
+        handleRemovePlayedCard(ss);
+    };
+
+    // Register command: "remove_held_card" - Discard card from hand
+    commandHandlers["remove_held_card"] = [this](std::istringstream& ss) {
+        handleRemoveHeldCard(ss);
+    };
+
+    // Register command: "advance_time" - Progress to next time of day
+    commandHandlers["advance_time"] = [this](std::istringstream&) {
+        handleAdvanceTime();
+    };
+
+    // Register command: "show_time" - Display current time of day
+    commandHandlers["show_time"] = [this](std::istringstream&) {
+        handleShowTime();
+    };
+
+    // Register command: "show_seed" - Display random engine and seed for replays
+    commandHandlers["show_seed"] = [this](std::istringstream&) {
+        handleShowSeed();
+    };
+
+    // Register command: "help" - Display command reference
+    commandHandlers["help"] = [this](std::istringstream&) {
+        handleHelp();
+    };
+}
+
+void GameEngine::handleSetColor(std::istringstream& ss) {
+    int x, y, z;
+    std::string color;
+    ss >> x >> y >> z >> color;
+
+    if (ss.fail()) {
+        print("Usage: set_color <x> <y> <z> <color>");
+        return;
+    }
+    
+    ColorId colorId;
+    if (!Colors::tryParse(color, colorId)) {
+        print(color + " is not a valid color. Valid colors: ");
+        for (const auto& c : Colors::all)
+            print("   " + c);
+        return;
+    }
+
+    board.setTileColor(x, y, z, colorId);
+    print("Set tile (" + std::to_string(x) + "," + std::to_string(y) + "," + std::to_string(z) + ") to " + color);
+}
+
+void GameEngine::handleSetOwner(std::istringstream& ss) {
+    int x, y, z;
+    int companyIndex;
+    ss >> x >> y >> z >> companyIndex;
+
+    if (ss.fail()) {
+        print("Usage: set_owner <x> <y> <z> <company_index>");
+        return;
+    }
+    
+    if (companyIndex < 0 || companyIndex >= companies.size()) {
+        print("Error: Company index " + std::to_string(companyIndex) + 
+              " is out of range. Max valid index: " + std::to_string(companies.size() - 1));
+        return;
+    }
+
+    board.setTileOwner(x, y, z, &companies[companyIndex]);
+    print("Set tile (" + std::to_string(x) + ", " + std::to_string(y) + ", " + 
+          std::to_string(z) + ") to " + companies[companyIndex].getName() + 
+          ": " + companies[companyIndex].getSymbol());
+}
+
+void GameEngine::handleBuild(std::istringstream& ss) {
+    int x, y, z;
+    std::string color;
+    int playerIndex = -1;
+
+    ss >> x >> y >> z >> color;
+    
+    if (ss.fail() || color.empty()) {
+        print("Usage: build <x> <y> <z> <color> [player_index]");
+        return;
+    }
+
+    // Optional player index parameter
+    if (!(ss >> playerIndex)) {
+        playerIndex = -1;
+    }
+
+    if (!validateAndSetPlayerIndex(playerIndex))
+        return;
+
+    ColorId colorId;
+    if (!Colors::tryParse(color, colorId)) {
+        print(color + " is not a valid color. Valid colors:");
+        for (const auto& c : Colors::all)
+            print("   " + c);
+        return;
+    }
+
+    std::size_t territory = buildStage(playerIndex, x, y, z, colorId);
+    print("Connected territory: " + std::to_string(territory) + " tile" + (territory == 1 ? "" : "s"));
+}
+
+void GameEngine::handleShowTerritory(std::istringstream& ss) {
+    int playerIndex = -1;
+
+    if (!(ss >> playerIndex)) {
+        playerIndex = -1; // Default to current active player
+    }
+
+    if (!validateAndSetPlayerIndex(playerIndex))
+        return;
+
+    Player& player = players[playerIndex];
+    std::size_t largest = board.getLargestTerritory(player.company);
+    print(player.name + " (" + player.company->getName() + ") largest territory: " +
+          std::to_string(largest) + " tile" + (largest == 1 ? "" : "s"));
+}
+
+void GameEngine::handleListPlayers() {
+    if (players.empty()) {
+        print("No players available.");
+    } else {
+        print("Players:");
+        for (const auto& p : players)
+            print(" - " + p.name + " (" + p.company->getName() + ": " + p.company->getSymbol() + ")");
+    }
+}
+
+void GameEngine::handleShowResources(std::istringstream& ss) {
+    int playerIndex = -1;
+    
+    if (!(ss >> playerIndex)) {
+        playerIndex = -1; // Default to current active player
+    }
+
+    if (!validateAndSetPlayerIndex(playerIndex))
+        return;
+
+    Player& player = players[playerIndex];
+    print("Resources for player " + player.name + ":");
+    player.forEachResource([this](ResourceId resource, int amount) {
+        print("  " + Resources::toString(resource) + ": " + std::to_string(amount));
+    });
+}
+
+void GameEngine::handleShowCards(std::istringstream& ss) {
+    int playerIndex = -1;
+
+    if (!(ss >> playerIndex)) {
+        playerIndex = -1; // Default to current active player
+    }
+
+    if (!validateAndSetPlayerIndex(playerIndex))
+        return;
+
+    Player& player = players[playerIndex];
+    std::vector<std::string> lines;
+
+    lines.push_back("Cards held by " + player.name + ":");
+    if (player.heldCards.empty())
+        lines.push_back("  (no cards)");
+    else
+        for (const auto& card : player.heldCards)
+            lines.push_back("  - " + card.getName());
+
+    printPaged(lines); // Use pagination for long card lists
+}
+
+void GameEngine::handleGetCardCount(std::istringstream& ss) {
+    std::string deckName;
+    ss >> deckName;
+
+    if (ss.fail()) {
+        print("Usage: get_card_count <deck_name>");
+        return;
+    }
+
+    Deck* deck = getDeckByName(deckName);
+    if (!deck) {
+        print("Error: Deck '" + deckName + "' not found.");
+        return;
+    }
+
+    int cardCount = deck->size();
+    print(deckName + " has " + std::to_string(cardCount) + " card" + (cardCount == 1 ? "" : "s"));
+}
+
+void GameEngine::handleDrawCard(std::istringstream& ss) {
+    std::string deckName;
+    int amount;
+    int playerIndex = -1;
+
+    ss >> deckName >> amount;
+    
+    if (ss.fail() || deckName.empty()) {
+        print("Usage: draw_card <deck_name> <amount> [player_index]");
+        return;
+    }
+
+    if (!(ss >> playerIndex)) {
+        playerIndex = -1; // Default to current active player
+    }
+
+    if (!validateAndSetPlayerIndex(playerIndex))
+        return;
+
+    Deck* deck = getDeckByName(deckName);
+    if (!deck) {
+        print("Error: Deck '" + deckName + "' not found.");
+        return;
+    }
+
+    drawCardForPlayer(*deck, players[playerIndex], amount);
+}
+
+void GameEngine::handleGiveResource(std::istringstream& ss) {
+    std::string resource;
+    int amount;
+    int playerIndex = -1;
+
+    ss >> resource >> amount;
+    
+    if (ss.fail() || resource.empty()) {
+        print("Usage: give_resource <resource> <amount> [player_index]");
+        return;
+    }
+
+    if (!(ss >> playerIndex)) {
+        playerIndex = -1; // Default to current active player
+    }
+
+    giveResourceToPlayer(playerIndex, Resources::intern(resource), amount);
+}
+
+void GameEngine::handleSpendResource(std::istringstream& ss) {
+    std::string resource;
+    int amount;
+    int playerIndex = -1;
+
+    ss >> resource >> amount;
+    
+    if (ss.fail() || resource.empty()) {
+        print("Usage: spend_resource <resource> <amount> [player_index]");
+        return;
+    }
+
+    if (!(ss >> playerIndex)) {
+        playerIndex = -1; // Default to current active player
+    }
+
+    // Only look the name up: nobody can hold a resource that was never given, and
+    // interning every typo would grow the process-wide name registry for good
+    ResourceId resourceId;
+    if (!Resources::tryParse(resource, resourceId)) {
+        print("Error: Unknown resource " + resource + ".");
+        return;
+    }
+
+    spendResourceFromPlayer(playerIndex, resourceId, amount);
+}
+
+void GameEngine::handlePlayCard(std::istringstream& ss) {
+    std::string cardName;
+    int playerIndex = -1;
+    
+    if (!parseCardNameWithOptionalPlayerIndex(ss, cardName, playerIndex)) {
+        print("Usage: play_card <card_name> [player_index]");
+        return;
+    }
+    
+    playCardForPlayer(playerIndex, cardName);
+}
+
+void GameEngine::handleRemovePlayedCard(std::istringstream& ss) {
+    std::string cardName;
+    int playerIndex = -1;
+    
+    if (!parseCardNameWithOptionalPlayerIndex(ss, cardName, playerIndex)) {
+        print("Usage: remove_played_card <card_name> [player_index]");
+        return;
+    }
+    
+    removePlayedCardForPlayer(playerIndex, cardName);
+}
+
+void GameEngine::handleRemoveHeldCard(std::istringstream& ss) {
+    std::string cardName;
+    int playerIndex = -1;
+    
+    if (!parseCardNameWithOptionalPlayerIndex(ss, cardName, playerIndex)) {
+        print("Usage: remove_held_card <card_name> [player_index]");
+        return;
+    }
+    
+    removeHeldCardForPlayer(playerIndex, cardName);
+}
+
+void GameEngine::handleAdvanceTime() {
+    advanceTimeOfDay(true);
+}
+
+void GameEngine::handleShowTime() {
+    print("Current time: " + getTimeOfDayString(currentTimeOfDay));
+}
+
+void GameEngine::handleShowSeed() {
+    print("Random engine: " + std::string(Rng::engineName(rng.getEngine())) +
+          ", seed: " + std::to_string(rng.getSeed()));
+}
+
+void GameEngine::handleHelp() {
+    std::vector<std::string> lines = {
+        "Available commands:",
+        "  set_color <x> <y> <z> <color>  - Sets the color of a tile.",
+        "  set_owner <x> <y> <z> <company_index>  - Assigns tile ownership.",
+        "  build <x> <y> <z> <color> [player_index]  - Builds a stage.",
+        "  show_territory [player_index]  - Shows a player's largest connected territory.",
+        "  list_players  - Lists all players.",
+        "  show_resources [player_index]  - Shows player resources.",
+        "  give_resource <resource> <amount> [player_index]  - Gives resources.",
+        "  spend_resource <resource> <amount> [player_index]  - Spends resources.",
+        "  show_cards [player_index]  - Lists player cards.",
+        "  get_card_count <deck_name>  - Shows total amount of cards left in a deck.",
+        "  draw_card <deck_name> <amount> [player_index]  - Draws cards for a player.",
+        "  play_card <card_name> [player_index]  - Plays a card from hand.",
+        "  remove_played_card <card_name> [player_index]  - Removes a card from play.",
+        "  remove_held_card <card_name> [player_index]  - Removes a card from hand.",
+        "  end_turn  - Ends the current player's turn.",
+        "  advance_time  - Advances to the next time of day.",
+        "  show_time  - Displays the current time of day.",
+        "  show_seed  - Displays the random engine and seed of this game.",
+        "  next  - Shows the next page of text (for long outputs).",
+        "  clear  - Clears the currently displayed output lines.",
+        "  help  - Displays this help message.",
+        "",
+        "Command Restrictions:",
+        "  Commands may be restricted to certain times of day.",
+        "  Prefix any command with ! to bypass time restrictions (cheat mode).",
+        "  Example: !build 0 0 0 Red"
+    };
+
+    printPaged(lines); // Use pagination for help text
+}
+
+void GameEngine::executeCommand(const std::string& cmd) {
+    if (cmd.empty()) return;
+    
+    // Check for cheat prefix (!)
+    bool isCheatCommand = (cmd[0] == '!');
+    std::string actualCmd = isCheatCommand ? cmd.substr(1) : cmd;
+    
+    std::istringstream ss(actualCmd);
+    std::string action;
+    ss >> action;
+
+    // Check time restrictions (unless cheat mode)
+    if (!isCheatCommand && !isCommandAllowedAtCurrentTime(action)) {
+        print("Command '" + action + "' cannot be used during " + 
+                      getTimeOfDayString(currentTimeOfDay) + ".");
+        print("Use !" + cmd + " to force execution (cheat mode).");
+        return;
+    }
+
+    // Lookup and execute command handler via function map
+    auto it = commandHandlers.find(action);
+    if (it != commandHandlers.end()) {
+        if (isCheatCommand) {
+            print("[CHEAT MODE] Executing: " + actualCmd);
+        }
+        it->second(ss); // Invoke lambda with remaining arguments
+    } else {
+        print("Unknown command: " + action);
+    }
+}
\ No newline at end of file
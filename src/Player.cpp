@@ -1,67 +1,96 @@
 #include "Player.hpp"
+#include "Deck.hpp"
 #include <iostream>
 #include <algorithm>
 
-Player::Player(const std::string& n, Company* c) : name(n), company(c) {
-    resources["talent"] = 0;
-    resources["staff"]  = 0;
-    resources["gear"]   = 0;
-    resources["funds"]  = 0;
+Player::Player(const std::string& n, Company* c) : name(n), company(c) {}
+
+void Player::addResource(ResourceId type, int amount) {
+    if (Resources::isKnown(type))
+        knownResources[static_cast<std::size_t>(type)] += amount;
+    else
+        extraResources[type] += amount;
 }
 
 void Player::addResource(const std::string& type, int amount) {
-    resources[type] += amount;
+    addResource(Resources::intern(type), amount);
 }
 
-bool Player::spendResource(const std::string& type, int amount) {
-    auto it = resources.find(type);
-    if (it == resources.end() || it->second < amount) {
+bool Player::spendResource(ResourceId type, int amount) {
+    int* held = nullptr;
+    if (Resources::isKnown(type)) {
+        held = &knownResources[static_cast<std::size_t>(type)];
+    } else {
+        auto it = extraResources.find(type);
+        if (it != extraResources.end())
+            held = &it->second;
+    }
+
+    if (!held || *held < amount) {
         return false;
     }
-    it->second -= amount;
+    *held -= amount;
     return true;
 }
 
+bool Player::spendResource(const std::string& type, int amount) {
+    ResourceId id;
+    return Resources::tryParse(type, id) && spendResource(id, amount);
+}
+
+int Player::getResource(ResourceId type) const {
+    if (Resources::isKnown(type))
+        return knownResources[static_cast<std::size_t>(type)];
+    auto it = extraResources.find(type);
+    return (it != extraResources.end()) ? it->second : 0;
+}
+
 int Player::getResource(const std::string& type) const {
-    auto it = resources.find(type);
-    return (it != resources.end()) ? it->second : 0;
+    ResourceId id;
+    return Resources::tryParse(type, id) ? getResource(id) : 0;
 }
 
 void Player::addHeldCard(const Card& card) {
-    heldCards.push_back(card);
+    receive(Card(card));
 }
 
-bool Player::playCard(const std::string& cardName) {
-    auto it = std::find_if(heldCards.begin(), heldCards.end(),
-                           [&](const Card& c) { return c.name == cardName; });
+void Player::receive(Card&& card) {
+    if (card.isValid())
+        heldCards.add(std::move(card));
+}
 
-    if (it == heldCards.end()) {
-        return false;
+Card* Player::playFromHand(CardId cardId) {
+    Card card;
+    if (!heldCards.take(cardId, card)) {
+        return nullptr;
     }
+    return &playedCards.add(std::move(card));
+}
 
-    playedCards.push_back(*it);
-    heldCards.erase(it);
-    return true;
+bool Player::playCard(CardId cardId) {
+    return playFromHand(cardId) != nullptr;
 }
 
-bool Player::removeHeldCard(const std::string& cardName) {
-    auto it = std::remove_if(heldCards.begin(), heldCards.end(),
-                             [&](const Card& c) { return c.name == cardName; });
-    if (it != heldCards.end()) {
-        heldCards.erase(it, heldCards.end());
-        return true;
+/** @brief Removes every copy of a card from a zone, moving them onto a discard pile if given. */
+static std::size_t discardAll(CardZone& zone, CardId cardId, Deck* discard) {
+    if (!discard)
+        return zone.removeAll(cardId);
+
+    std::size_t removed = 0;
+    Card card;
+    while (zone.take(cardId, card)) {
+        discard->put(std::move(card));
+        ++removed;
     }
-    return false;
+    return removed;
 }
 
-bool Player::removePlayedCard(const std::string& cardName) {
-    auto it = std::remove_if(playedCards.begin(), playedCards.end(),
-                             [&](const Card& c) { return c.name == cardName; });
-    if (it != playedCards.end()) {
-        playedCards.erase(it, playedCards.end());
-        return true;
-    }
-    return false;
+bool Player::removeHeldCard(CardId cardId, Deck* discard) {
+    return discardAll(heldCards, cardId, discard) != 0;
+}
+
+bool Player::removePlayedCard(CardId cardId, Deck* discard) {
+    return discardAll(playedCards, cardId, discard) != 0;
 }
 
 void Player::addScore(int amount) {
@@ -78,14 +107,15 @@ void Player::printStatus() const {
     std::cout << "Score: " << score << "\n";
 
     std::cout << "Resources:\n";
-    for (const auto& [key, val] : resources)
-        std::cout << "  - " << key << ": " << val << "\n";
+    forEachResource([](ResourceId type, int amount) {
+        std::cout << "  - " << Resources::toString(type) << ": " << amount << "\n";
+    });
 
     std::cout << "Held Cards:\n";
     for (const auto& card : heldCards)
-        std::cout << "  - " << card.name << "\n";
+        std::cout << "  - " << card.getName() << "\n";
 
     std::cout << "Played Cards:\n";
     for (const auto& card : playedCards)
-        std::cout << "  - " << card.name << "\n";
+        std::cout << "  - " << card.getName() << "\n";
 }
@@ -0,0 +1,81 @@
+#include "RegionTracker.hpp"
+#include "Board.hpp"
+#include <algorithm>
+
+RegionTracker::RegionTracker(std::uint8_t ignoredLabel_) : ignoredLabel(ignoredLabel_) {
+    largest.fill(0);
+}
+
+// Resets every tile to a singleton, then unions each labeled tile with its
+// higher-indexed neighbors so each edge is visited once.
+void RegionTracker::rebuild(const Board& board, const std::uint8_t* labels) {
+    const std::size_t count = board.tileCount();
+    parent.resize(count);
+    sizes.assign(count, 1);
+    largest.fill(0);
+
+    for (std::size_t i = 0; i < count; ++i)
+        parent[i] = static_cast<int>(i);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        std::uint8_t label = labels[i];
+        if (label == ignoredLabel)
+            continue;
+
+        largest[label] = std::max<std::uint32_t>(largest[label], 1);
+        board.forEachNeighbor(i, [&](int neighbor) {
+            if (static_cast<std::size_t>(neighbor) > i && labels[neighbor] == label)
+                unite(static_cast<int>(i), neighbor, label);
+        });
+    }
+    dirty = false;
+}
+
+void RegionTracker::onLabelChanged(const Board& board, const std::uint8_t* labels, std::size_t index, std::uint8_t oldLabel) {
+    std::uint8_t label = labels[index];
+    if (dirty || label == oldLabel)
+        return;
+
+    // Removing a tile from a region may split it; union-find cannot undo merges.
+    if (oldLabel != ignoredLabel) {
+        dirty = true;
+        return;
+    }
+
+    // The tile was an ignored singleton root, so it can be merged in place.
+    largest[label] = std::max<std::uint32_t>(largest[label], 1);
+    board.forEachNeighbor(index, [&](int neighbor) {
+        if (labels[neighbor] == label)
+            unite(static_cast<int>(index), neighbor, label);
+    });
+}
+
+std::size_t RegionTracker::regionSize(std::size_t index) {
+    return sizes[find(static_cast<int>(index))];
+}
+
+bool RegionTracker::sameRegion(std::size_t a, std::size_t b) {
+    return find(static_cast<int>(a)) == find(static_cast<int>(b));
+}
+
+int RegionTracker::find(int index) {
+    while (parent[index] != index) {
+        parent[index] = parent[parent[index]];
+        index = parent[index];
+    }
+    return index;
+}
+
+// Union by size keeps trees shallow; the merged size feeds the per-label maximum.
+void RegionTracker::unite(int a, int b, std::uint8_t label) {
+    int rootA = find(a);
+    int rootB = find(b);
+    if (rootA == rootB)
+        return;
+
+    if (sizes[rootA] < sizes[rootB])
+        std::swap(rootA, rootB);
+    parent[rootB] = rootA;
+    sizes[rootA] += sizes[rootB];
+    largest[label] = std::max(largest[label], sizes[rootA]);
+}
@@ -1,81 +1,359 @@
 #include "Renderer.hpp"
 #include "CommandConsole.hpp"
-#include "Colors.hpp"
+#include <algorithm>
 #include <cmath>
+#include <string>
 
 #include <iostream>
 
+namespace {
+
+const sf::Color BACKGROUND(30, 30, 30);                 // Window and board layer clear color
+const float HEX_RADIUS = 25.f;                          // Center-to-corner distance in pixels
+const sf::Vector2f BOARD_CENTER(400.f, 300.f);          // Screen position of tile (0, 0, 0)
+constexpr std::size_t VERTICES_PER_HEX = 18;            // Six triangles of three vertices
+constexpr unsigned int COORD_TEXT_SIZE = 12;            // Character size of coordinate labels
+constexpr unsigned int SYMBOL_TEXT_SIZE = 24;           // Character size of company symbols
+const sf::Vector2f COORD_OFFSET(0.f, 16.f);             // Coordinate label center, from tile center
+const sf::Vector2f SYMBOL_OFFSET(0.f, -12.f);           // Symbol center, from tile center
+constexpr float MIN_ZOOM = 0.25f;                       // Closest zoom level (4x magnification)
+constexpr float MAX_ZOOM = 16.f;                        // Farthest zoom level
+constexpr float WHEEL_ZOOM_STEP = 1.2f;                 // Zoom factor per mouse wheel notch
+constexpr float LABEL_MIN_RADIUS = 18.f;                // On-screen hex radius below which coordinates are hidden
+constexpr float SYMBOL_MIN_RADIUS = 8.f;                // On-screen hex radius below which symbols are hidden
+
+} // namespace
+
+// SFML color equivalents for in-game rendering, in ColorId order.
+const std::array<sf::Color, COLOR_COUNT> Renderer::tileColors = {
+    sf::Color(0xD9, 0x7B, 0x66), // Red
+    sf::Color(0xE3, 0xC5, 0x67), // Yellow
+    sf::Color(0x6C, 0x8E, 0xBF), // Blue
+    sf::Color(0x7C, 0xA9, 0x82), // Green
+    sf::Color(0xA8, 0x8E, 0xC6), // Purple
+    sf::Color(0xF2, 0xE9, 0xE4), // White
+    sf::Color(0xB0, 0xA8, 0xB9), // Gray
+    sf::Color(0x4B, 0x4A, 0x54)  // Neutral
+};
+
 Renderer::Renderer(Board& b, sf::Font& f)
-    : board(b), font(f)
+    : board(b), font(f),
+      coordBatch(f, COORD_TEXT_SIZE),
+      symbolBatch(f, SYMBOL_TEXT_SIZE)
 {}
 
+const sf::Color& Renderer::getTileColor(ColorId id) {
+    return tileColors[static_cast<size_t>(id)];
+}
+
 
-void Renderer::handleEvents(sf::RenderWindow& window, CommandConsole& console) {
+/**
+ * @details
+ * When blocking, the first event is awaited with waitEvent() so an idle window uses no
+ * CPU; any further queued events are then drained without blocking.
+ */
+void Renderer::handleEvents(sf::RenderWindow& window, CommandConsole& console, bool block) {
     sf::Event event;
-    while (window.pollEvent(event)) {
+    bool haveEvent = block ? window.waitEvent(event) : window.pollEvent(event);
+    while (haveEvent) {
         if (event.type == sf::Event::Closed)
             window.close();
+        else if (event.type == sf::Event::Resized || event.type == sf::Event::GainedFocus)
+            windowInvalid = true;
+        handleCameraEvent(window, event);
         console.handleEvent(event);
+        haveEvent = window.pollEvent(event);
+    }
+}
+
+void Renderer::handleCameraEvent(const sf::RenderWindow& window, const sf::Event& event) {
+    if (!cameraReady)
+        resetCamera(window);
+
+    switch (event.type) {
+    case sf::Event::MouseWheelScrolled:
+        if (event.mouseWheelScroll.wheel == sf::Mouse::VerticalWheel && event.mouseWheelScroll.delta != 0.f) {
+            const sf::Vector2i pixel(event.mouseWheelScroll.x, event.mouseWheelScroll.y);
+            zoomCamera(window, pixel, event.mouseWheelScroll.delta > 0.f ? 1.f / WHEEL_ZOOM_STEP : WHEEL_ZOOM_STEP);
+        }
+        break;
+
+    case sf::Event::MouseButtonPressed:
+        if (event.mouseButton.button == sf::Mouse::Right || event.mouseButton.button == sf::Mouse::Middle) {
+            dragging = true;
+            dragPixel = sf::Vector2i(event.mouseButton.x, event.mouseButton.y);
+        }
+        break;
+
+    case sf::Event::MouseButtonReleased:
+        if (event.mouseButton.button == sf::Mouse::Right || event.mouseButton.button == sf::Mouse::Middle)
+            dragging = false;
+        break;
+
+    case sf::Event::MouseMoved:
+        if (dragging) {
+            const sf::Vector2i pixel(event.mouseMove.x, event.mouseMove.y);
+            camera.move(window.mapPixelToCoords(dragPixel, camera) - window.mapPixelToCoords(pixel, camera));
+            dragPixel = pixel;
+            boardLayerDirty = true;
+        }
+        break;
+
+    case sf::Event::KeyPressed:
+        if (event.key.code == sf::Keyboard::Home) {
+            resetCamera(window);
+            boardLayerDirty = true;
+        }
+        break;
+
+    default:
+        break;
     }
 }
 
+/**
+ * @details
+ * The board layer fills the window's default view, so mapping a window pixel through the
+ * camera gives the board point drawn there.
+ */
+void Renderer::zoomCamera(const sf::RenderWindow& window, const sf::Vector2i& pixel, float factor) {
+    const float target = std::min(MAX_ZOOM, std::max(MIN_ZOOM, zoomLevel * factor));
+    if (target == zoomLevel)
+        return;
+
+    const sf::Vector2f before = window.mapPixelToCoords(pixel, camera);
+    camera.setSize(window.getDefaultView().getSize() * target);
+    zoomLevel = target;
+    camera.move(before - window.mapPixelToCoords(pixel, camera));
+    boardLayerDirty = true;
+}
+
+void Renderer::resetCamera(const sf::RenderWindow& window) {
+    camera = window.getDefaultView();
+    zoomLevel = 1.f;
+    cameraReady = true;
+}
+
+bool Renderer::needsRender(const CommandConsole& console) const {
+    return windowInvalid || boardLayerDirty || board.hasDirtyTiles() || console.isDirty();
+}
+
+/**
+ * @details
+ * Typing in the console therefore costs one textured quad for the board rather than
+ * the hex mesh and every label.
+ */
 void Renderer::render(sf::RenderWindow& window, CommandConsole& console) {
-    window.clear(sf::Color(30, 30, 30));
-    drawBoard(window);
+    if (!cameraReady)
+        resetCamera(window);
+    window.clear(BACKGROUND);
+
+    if (ensureBoardLayer(window)) {
+        if (boardLayerDirty || board.hasDirtyTiles()) {
+            boardLayer.clear(BACKGROUND);
+            boardLayer.setView(camera);
+            drawBoard(boardLayer);
+            boardLayer.display();
+        }
+        window.draw(sf::Sprite(boardLayer.getTexture()));
+    } else {
+        window.setView(camera);
+        drawBoard(window);
+        window.setView(window.getDefaultView());
+    }
+    boardLayerDirty = false;
+
     console.draw(window);
     window.display();
+
+    console.clearDirty();
+    windowInvalid = false;
+}
+
+/**
+ * @details
+ * The layer is sized to the window's default view rather than its pixel size, so
+ * drawing it at the origin lines up with the board however the window is stretched.
+ */
+bool Renderer::ensureBoardLayer(const sf::RenderWindow& window) {
+    if (!boardLayerSupported)
+        return false;
+
+    const sf::Vector2f viewSize = window.getDefaultView().getSize();
+    const sf::Vector2u size(static_cast<unsigned int>(viewSize.x), static_cast<unsigned int>(viewSize.y));
+    if (boardLayer.getSize() != size) {
+        if (!boardLayer.create(size.x, size.y)) {
+            std::cerr << "Warning: Could not create the board layer; drawing the board directly.\n";
+            boardLayerSupported = false;
+            return false;
+        }
+        boardLayerDirty = true;
+    }
+    return true;
 }
 
+void Renderer::drawBoard(sf::RenderTarget& target) {
+    if (tileCenters.size() != board.tileCount())
+        buildBoardMesh();
+    updateBoardMesh();
 
-void Renderer::drawBoard(sf::RenderWindow& window) {
-    const float hexRadius = 25.f;
-    const float hexHeight = std::sqrt(3.f) * hexRadius;
-    const sf::Vector2f center(400, 300);
+    if (symbolsDirty)
+        rebuildSymbols();
 
-    for (const auto& [coord, tile] : board.tiles) {
-        float q = static_cast<float>(coord.x);
-        float r = static_cast<float>(coord.z);
+    const sf::View& view = target.getView();
+    collectVisibleSpans(view);
 
-        float x = hexRadius * 1.5f * q + center.x;
-        float y = hexHeight * (r + q / 2.f) + center.y;
+    // Level of detail: skip text that would be too small to read at this zoom
+    const float screenRadius = HEX_RADIUS * static_cast<float>(target.getSize().x) / view.getSize().x;
+    const bool drawSymbols = screenRadius >= SYMBOL_MIN_RADIUS;
+    const bool drawLabels = screenRadius >= LABEL_MIN_RADIUS;
 
-        sf::CircleShape hex(hexRadius, 6);
-        hex.setOrigin(hexRadius, hexRadius);
-        hex.setPosition(x, y);
-        hex.setRotation(30);
+    for (const auto& [first, last] : visibleSpans)
+        target.draw(&hexMesh[first * VERTICES_PER_HEX], (last - first) * VERTICES_PER_HEX, sf::Triangles);
 
-        const std::string& colorName = tile.getColor();
-        hex.setFillColor(Colors::getSfmlColor(colorName));
+    for (const auto& [first, last] : visibleSpans) {
+        if (drawSymbols)
+            symbolBatch.drawRange(target, symbolStart[first], symbolStart[last] - symbolStart[first]);
+        if (drawLabels)
+            coordBatch.drawRange(target, coordStart[first], coordStart[last] - coordStart[first]);
+    }
+}
 
-        window.draw(hex);
-        Company* owner = tile.getOwner();
-        if (owner != nullptr) {
+/**
+ * @details
+ * A tile at axial (q, r) is centered at x = 1.5 * R * q and y = H * (r + q / 2) around
+ * BOARD_CENTER, where R is the hex radius and H the hex height. Inverting that gives the
+ * q range visible horizontally and, per row r, the q range visible vertically; their
+ * intersection with the row is one run of consecutive tile indices. The view is padded by
+ * one hex radius so partly visible hexes are kept.
+ */
+void Renderer::collectVisibleSpans(const sf::View& view) {
+    visibleSpans.clear();
 
-            sf::Text symbolText;
-            symbolText.setFont(font);
-            symbolText.setString(owner->getSymbol());
-            symbolText.setCharacterSize(24);
-            symbolText.setFillColor(sf::Color::Black);
+    const float hexHeight = std::sqrt(3.f) * HEX_RADIUS;
+    const sf::Vector2f halfSize = view.getSize() / 2.f;
+    const float left = view.getCenter().x - halfSize.x - HEX_RADIUS - BOARD_CENTER.x;
+    const float right = view.getCenter().x + halfSize.x + HEX_RADIUS - BOARD_CENTER.x;
+    const float top = (view.getCenter().y - halfSize.y - HEX_RADIUS - BOARD_CENTER.y) / hexHeight;
+    const float bottom = (view.getCenter().y + halfSize.y + HEX_RADIUS - BOARD_CENTER.y) / hexHeight;
 
-            sf::FloatRect symBounds = symbolText.getLocalBounds();
-            symbolText.setOrigin(symBounds.width / 2.f, symBounds.height / 2.f);
-            symbolText.setPosition(x, y - 12);
+    const int radius = board.getRadius();
+    const int qLeft = static_cast<int>(std::ceil(left / (1.5f * HEX_RADIUS)));
+    const int qRight = static_cast<int>(std::floor(right / (1.5f * HEX_RADIUS)));
 
-            window.draw(symbolText);
+    for (int r = -radius; r <= radius; ++r) {
+        const int rowFirst = std::max(-radius, -radius - r);
+        const int rowLast = std::min(radius, radius - r);
+
+        const int qFirst = std::max({rowFirst, qLeft, static_cast<int>(std::ceil(2.f * (top - r)))});
+        const int qLast = std::min({rowLast, qRight, static_cast<int>(std::floor(2.f * (bottom - r)))});
+        if (qFirst > qLast)
+            continue;
+
+        const std::size_t first = static_cast<std::size_t>(board.indexOf(CubeCoord(qFirst, -qFirst - r, r)));
+        const std::size_t last = first + static_cast<std::size_t>(qLast - qFirst) + 1;
+        if (!visibleSpans.empty() && visibleSpans.back().second == first)
+            visibleSpans.back().second = last;
+        else
+            visibleSpans.emplace_back(first, last);
+    }
+}
+
+/**
+ * @details
+ * Each hex is a fan of six triangles around its center with flat top and bottom edges,
+ * matching the previous CircleShape(hexRadius, 6) rotated by 30 degrees. Coordinate
+ * labels never change, so they are laid out here once. Every tile's color and owner are
+ * then written, so the board's dirty list is no longer needed.
+ */
+void Renderer::buildBoardMesh() {
+    const std::size_t count = board.tileCount();
+    const float hexHeight = std::sqrt(3.f) * HEX_RADIUS;
+
+    sf::Vector2f corners[6];
+    for (int k = 0; k < 6; ++k) {
+        const float angle = 3.14159265f / 3.f * static_cast<float>(k);
+        corners[k] = sf::Vector2f(HEX_RADIUS * std::cos(angle), HEX_RADIUS * std::sin(angle));
+    }
+
+    tileCenters.resize(count);
+    hexMesh.resize(count * VERTICES_PER_HEX);
+    meshOwners.assign(count, BoardView::UNOWNED);
+    coordBatch.clear();
+    coordStart.resize(count + 1);
+    symbolStart.assign(count + 1, 0);
+    symbolsDirty = true;
+
+    for (std::size_t i = 0; i < count; ++i) {
+        const CubeCoord& coord = board.getCoord(i);
+        const float q = static_cast<float>(coord.x);
+        const float r = static_cast<float>(coord.z);
+        const sf::Vector2f center(HEX_RADIUS * 1.5f * q + BOARD_CENTER.x,
+                                  hexHeight * (r + q / 2.f) + BOARD_CENTER.y);
+        tileCenters[i] = center;
+
+        sf::Vertex* tri = &hexMesh[i * VERTICES_PER_HEX];
+        for (int k = 0; k < 6; ++k) {
+            tri[k * 3].position = center;
+            tri[k * 3 + 1].position = center + corners[k];
+            tri[k * 3 + 2].position = center + corners[(k + 1) % 6];
         }
 
-        sf::Text coordText;
-        coordText.setFont(font);
-        coordText.setString("(" + std::to_string(coord.x) + ", " +
-                                 std::to_string(coord.y) + ", " +
-                                 std::to_string(coord.z) + ")");
-        coordText.setCharacterSize(12);
-        coordText.setFillColor(sf::Color(50, 50, 50));
+        coordStart[i] = coordBatch.getVertexCount();
+        coordBatch.add("(" + std::to_string(coord.x) + ", " +
+                             std::to_string(coord.y) + ", " +
+                             std::to_string(coord.z) + ")",
+                       center + COORD_OFFSET, sf::Color(50, 50, 50));
+
+        updateTile(i);
+    }
+    coordStart[count] = coordBatch.getVertexCount();
+    board.clearDirtyTiles();
+}
+
+void Renderer::updateBoardMesh() {
+    for (int index : board.getDirtyTiles())
+        updateTile(static_cast<std::size_t>(index));
+    board.clearDirtyTiles();
+}
+
+void Renderer::updateTile(std::size_t index) {
+    const BoardView& view = board.getView();
+
+    const sf::Color& fill = getTileColor(static_cast<ColorId>(view.colorData()[index]));
+    sf::Vertex* tri = &hexMesh[index * VERTICES_PER_HEX];
+    for (std::size_t v = 0; v < VERTICES_PER_HEX; ++v)
+        tri[v].color = fill;
+
+    const std::uint8_t ownerId = view.ownerData()[index];
+    if (ownerId != meshOwners[index]) {
+        meshOwners[index] = ownerId;
+        symbolsDirty = true;
+    }
+}
+
+/**
+ * @details
+ * Ownership changes are rare next to frames, so the whole batch is rebuilt from the
+ * cached per-company glyphs rather than patched; that is a copy of a few vertices per tile.
+ */
+void Renderer::rebuildSymbols() {
+    const BoardView& view = board.getView();
+    if (symbolGlyphs.size() < view.ownerIdCount())
+        symbolGlyphs.resize(view.ownerIdCount());
 
-        sf::FloatRect bounds = coordText.getLocalBounds();
-        coordText.setOrigin(bounds.width / 2.f, bounds.height / 2.f);
-        coordText.setPosition(x, y + 16);
+    symbolBatch.clear();
+    for (std::size_t i = 0; i < meshOwners.size(); ++i) {
+        symbolStart[i] = symbolBatch.getVertexCount();
+        const std::uint8_t ownerId = meshOwners[i];
+        if (ownerId == BoardView::UNOWNED)
+            continue;
 
-        window.draw(coordText);
+        std::vector<sf::Vertex>& glyphs = symbolGlyphs[ownerId];
+        if (glyphs.empty())
+            symbolBatch.layout(view.getCompany(ownerId)->getSymbol(), sf::Color::Black, glyphs);
+        symbolBatch.append(glyphs, tileCenters[i] + SYMBOL_OFFSET);
     }
+    symbolStart[meshOwners.size()] = symbolBatch.getVertexCount();
+    symbolsDirty = false;
 }
@@ -0,0 +1,66 @@
+#include "Resources.hpp"
+#include <array>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+namespace {
+
+// Names of the standard resources, in ResourceId order.
+const std::array<std::string, KNOWN_RESOURCE_COUNT> KNOWN_NAMES = {
+    "talent", "staff", "gear", "funds"
+};
+
+// Names interned at runtime. A deque keeps returned references stable as it grows.
+std::mutex dynamicMutex;
+std::deque<std::string> dynamicNames;
+std::unordered_map<std::string, ResourceId> dynamicIds;
+
+bool findKnown(const std::string& name, ResourceId& id) {
+    for (std::size_t i = 0; i < KNOWN_RESOURCE_COUNT; ++i) {
+        if (name == KNOWN_NAMES[i]) {
+            id = static_cast<ResourceId>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+ResourceId Resources::intern(const std::string& name) {
+    ResourceId id;
+    if (findKnown(name, id))
+        return id;
+
+    std::lock_guard<std::mutex> lock(dynamicMutex);
+    auto it = dynamicIds.find(name);
+    if (it != dynamicIds.end())
+        return it->second;
+
+    id = static_cast<ResourceId>(KNOWN_RESOURCE_COUNT + dynamicNames.size());
+    dynamicNames.push_back(name);
+    dynamicIds.emplace(name, id);
+    return id;
+}
+
+bool Resources::tryParse(const std::string& name, ResourceId& id) {
+    if (findKnown(name, id))
+        return true;
+
+    std::lock_guard<std::mutex> lock(dynamicMutex);
+    auto it = dynamicIds.find(name);
+    if (it == dynamicIds.end())
+        return false;
+    id = it->second;
+    return true;
+}
+
+const std::string& Resources::toString(ResourceId id) {
+    std::size_t index = static_cast<std::size_t>(id);
+    if (index < KNOWN_RESOURCE_COUNT)
+        return KNOWN_NAMES[index];
+
+    std::lock_guard<std::mutex> lock(dynamicMutex);
+    return dynamicNames[index - KNOWN_RESOURCE_COUNT];
+}
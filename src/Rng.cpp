@@ -0,0 +1,56 @@
+#include "Rng.hpp"
+
+Rng::Rng(RngEngine engine_, std::uint64_t seed_)
+    : engine(engine_)
+{
+    seed(seed_);
+}
+
+/**
+ * @details
+ * xoshiro256** must not start from an all-zero state, so its four words are
+ * expanded from the seed with SplitMix64, as its authors recommend.
+ */
+void Rng::seed(std::uint64_t seed_) {
+    currentSeed = seed_;
+
+    if (engine == RngEngine::Mt19937) {
+        mt.seed(seed_);
+        return;
+    }
+
+    std::uint64_t z = seed_;
+    for (auto& word : state) {
+        z += 0x9E3779B97F4A7C15ULL;
+        std::uint64_t x = z;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+        word = x ^ (x >> 31);
+    }
+}
+
+void Rng::setEngine(RngEngine engine_) {
+    engine = engine_;
+    seed(currentSeed);
+}
+
+std::uint64_t Rng::deviceSeed() {
+    std::random_device rd;
+    return (static_cast<std::uint64_t>(rd()) << 32) ^ rd();
+}
+
+bool Rng::tryParseEngine(const std::string& name, RngEngine& out) {
+    if (name == "mt19937") {
+        out = RngEngine::Mt19937;
+        return true;
+    }
+    if (name == "xoshiro256") {
+        out = RngEngine::Xoshiro256;
+        return true;
+    }
+    return false;
+}
+
+const char* Rng::engineName(RngEngine engine) {
+    return engine == RngEngine::Xoshiro256 ? "xoshiro256" : "mt19937";
+}
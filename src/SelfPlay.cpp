@@ -0,0 +1,186 @@
+#include "SelfPlay.hpp"
+#include <algorithm>
+#include <iomanip>
+#include <set>
+#include <tuple>
+
+// Number of random probes for a tile bordering the player's own territory.
+constexpr int ADJACENT_BUILD_PROBES = 8;
+
+SelfPlayGame::SelfPlayGame(const SelfPlayConfig& cfg, std::uint64_t seed_)
+    : GameEngine(cfg.boardRadius, {}),
+      config(cfg),
+      seed(seed_)
+{
+    setQuiet(true);
+    setRngEngine(config.engine);
+    setSeed(seed);
+
+    // Companies live inside the engine so player pointers stay valid for its lifetime
+    companies.reserve(config.playerCount);
+    for (int i = 0; i < config.playerCount; ++i)
+        companies.emplace_back("Company " + std::to_string(i + 1), std::string(1, static_cast<char>('A' + i)));
+    for (int i = 0; i < config.playerCount; ++i)
+        addPlayer("Bot " + std::to_string(i + 1), &companies[i]);
+
+    played.resize(config.playerCount);
+}
+
+GameOutcome SelfPlayGame::play() {
+    setup();
+
+    for (int day = 0; day < config.days; ++day) {
+        for (int turn = 0; turn < config.playerCount; ++turn)
+            takeTurn(currentActivePlayerIndex);
+    }
+
+    GameOutcome outcome;
+    outcome.seed = seed;
+    for (int i = 0; i < config.playerCount; ++i) {
+        const Player& player = players[i];
+        PlayerOutcome result;
+        result.company = player.company->getName();
+        result.largestTerritory = board.getLargestTerritory(player.company);
+        result.tilesOwned = board.getView().countOwnedBy(player.company);
+        player.forEachResource([&](ResourceId type, int amount) {
+            result.resources[Resources::toString(type)] = amount;
+        });
+        result.cardsPlayed = std::move(played[i]);
+        outcome.players.push_back(std::move(result));
+    }
+
+    auto score = [&](int i) {
+        const PlayerOutcome& p = outcome.players[i];
+        auto funds = p.resources.find("funds");
+        return std::make_tuple(p.largestTerritory, p.tilesOwned, funds != p.resources.end() ? funds->second : 0);
+    };
+    outcome.winner = 0;
+    for (int i = 1; i < config.playerCount; ++i) {
+        if (score(i) > score(outcome.winner))
+            outcome.winner = i;
+    }
+    return outcome;
+}
+
+void SelfPlayGame::takeTurn(int playerIndex) {
+    Player& player = players[playerIndex];
+
+    Deck* drawDeck = getDeckByName("drawDeck");
+    if (drawDeck && !drawDeck->empty())
+        drawCardForPlayer(*drawDeck, player, 1);
+
+    // Play the whole hand, newest card first
+    while (!player.heldCards.empty()) {
+        std::string cardName = player.heldCards.back().getName();
+        playCardForPlayer(playerIndex, cardName, false);
+        played[playerIndex].push_back(std::move(cardName));
+    }
+
+    std::uniform_int_distribution<> colorDist(0, static_cast<int>(ColorId::Neutral) - 1);
+    while (player.getResource(ResourceId::Funds) >= config.buildCost) {
+        spendResourceFromPlayer(playerIndex, ResourceId::Funds, config.buildCost, false);
+        const CubeCoord& target = board.getCoord(chooseBuildTile(player.company));
+        buildStage(playerIndex, target.x, target.y, target.z, static_cast<ColorId>(colorDist(rng)));
+    }
+
+    endTurn(false);
+}
+
+std::size_t SelfPlayGame::chooseBuildTile(const Company* company) {
+    std::uniform_int_distribution<std::size_t> tileDist(0, board.tileCount() - 1);
+
+    std::size_t fallback = tileDist(rng);
+    for (int probe = 0; probe < ADJACENT_BUILD_PROBES; ++probe) {
+        std::size_t candidate = tileDist(rng);
+        if (board.tiles[candidate].getOwner() == company)
+            continue;
+
+        bool borders = false;
+        board.forEachNeighbor(candidate, [&](int neighbor) {
+            borders |= (board.tiles[neighbor].getOwner() == company);
+        });
+        if (borders)
+            return candidate;
+        fallback = candidate;
+    }
+    return fallback;
+}
+
+void SimStats::add(const GameOutcome& outcome) {
+    ++games;
+
+    std::set<std::string> playedThisGame;
+    std::set<std::string> winnerPlayed;
+    for (std::size_t i = 0; i < outcome.players.size(); ++i) {
+        const PlayerOutcome& player = outcome.players[i];
+        bool isWinner = static_cast<int>(i) == outcome.winner;
+
+        CompanyTotals& totals = companies[player.company];
+        ++totals.games;
+        totals.wins += isWinner;
+        totals.territory += player.largestTerritory;
+        totals.tiles += player.tilesOwned;
+        for (const auto& [resource, amount] : player.resources)
+            totals.resources[resource] += amount;
+
+        for (const auto& cardName : player.cardsPlayed) {
+            CardTotals& card = cards[cardName];
+            ++card.timesPlayed;
+            card.playsByWinner += isWinner;
+            playedThisGame.insert(cardName);
+            if (isWinner)
+                winnerPlayed.insert(cardName);
+        }
+    }
+
+    for (const auto& cardName : playedThisGame)
+        ++cards[cardName].gamesPlayedIn;
+    for (const auto& cardName : winnerPlayed)
+        ++cards[cardName].winnerGames;
+}
+
+void SimStats::merge(const SimStats& other) {
+    games += other.games;
+
+    for (const auto& [name, theirs] : other.companies) {
+        CompanyTotals& ours = companies[name];
+        ours.games += theirs.games;
+        ours.wins += theirs.wins;
+        ours.territory += theirs.territory;
+        ours.tiles += theirs.tiles;
+        for (const auto& [resource, amount] : theirs.resources)
+            ours.resources[resource] += amount;
+    }
+
+    for (const auto& [name, theirs] : other.cards) {
+        CardTotals& ours = cards[name];
+        ours.timesPlayed += theirs.timesPlayed;
+        ours.playsByWinner += theirs.playsByWinner;
+        ours.gamesPlayedIn += theirs.gamesPlayedIn;
+        ours.winnerGames += theirs.winnerGames;
+    }
+}
+
+void SimStats::print(std::ostream& out) const {
+    out << std::fixed << std::setprecision(2);
+
+    out << "\n=== Companies (" << games << " games) ===\n";
+    for (const auto& [name, totals] : companies) {
+        double gameCount = static_cast<double>(std::max<std::size_t>(totals.games, 1));
+        out << name << ": win rate " << 100.0 * totals.wins / gameCount << "%"
+            << ", avg territory " << totals.territory / gameCount
+            << ", avg tiles " << totals.tiles / gameCount << "\n";
+        for (const auto& [resource, amount] : totals.resources)
+            out << "  - avg " << resource << ": " << amount / gameCount << "\n";
+    }
+
+    out << "\n=== Cards ===\n";
+    for (const auto& [name, totals] : cards) {
+        double perGame = static_cast<double>(totals.timesPlayed) / static_cast<double>(std::max<std::size_t>(games, 1));
+        double winnerShare = totals.timesPlayed ? 100.0 * totals.playsByWinner / totals.timesPlayed : 0.0;
+        double winnerPresence = totals.gamesPlayedIn ? 100.0 * totals.winnerGames / totals.gamesPlayedIn : 0.0;
+        out << name << ": " << perGame << " plays/game"
+            << ", " << winnerShare << "% of plays by winner"
+            << ", winner played it in " << winnerPresence << "% of games it appeared in\n";
+    }
+}
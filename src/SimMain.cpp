@@ -0,0 +1,151 @@
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "SelfPlay.hpp"
+#include "ThreadPool.hpp"
+
+// Games per pool task; large enough to amortize scheduling, small enough to balance load.
+constexpr std::size_t GAMES_PER_TASK = 16;
+
+/**
+ * @brief Derives a well-spread per-game seed from the batch seed and game index.
+ *
+ * Uses the SplitMix64 sequence so neighboring game indices get unrelated seeds.
+ */
+static std::uint64_t gameSeed(std::uint64_t baseSeed, std::uint64_t gameIndex) {
+    std::uint64_t z = baseSeed + 0x9E3779B97F4A7C15ULL * (gameIndex + 1);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static void printUsage() {
+    std::cout << "Usage: spotlight_sim [--games N] [--threads T] [--seed S] [--rng mt19937|xoshiro256]\n"
+              << "                     [--players P] [--radius R] [--days D] [--build-cost C]\n"
+              << "                     [--log <file|->] [--log-level off|summary|detail]\n";
+}
+
+/**
+ * @brief Plays a batch of independent self-play games across all cores and prints statistics.
+ *
+ * Results are gathered per task and merged in task order, so output depends only on
+ * the seed and game count, never on the number of threads.
+ */
+int main(int argc, char** argv) {
+    std::size_t gameCount = 1000;
+    std::size_t threadCount = 0;
+    std::uint64_t baseSeed = 1;
+    SelfPlayConfig config;
+    std::string logTarget;
+    EventVerbosity logVerbosity = EventVerbosity::Summary;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            printUsage();
+            return 0;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << arg << "\n";
+            printUsage();
+            return 1;
+        }
+
+        const char* value = argv[++i];
+        if (arg == "--games") gameCount = std::strtoull(value, nullptr, 10);
+        else if (arg == "--threads") threadCount = std::strtoull(value, nullptr, 10);
+        else if (arg == "--seed") baseSeed = std::strtoull(value, nullptr, 10);
+        else if (arg == "--players") config.playerCount = std::atoi(value);
+        else if (arg == "--radius") config.boardRadius = std::atoi(value);
+        else if (arg == "--days") config.days = std::atoi(value);
+        else if (arg == "--build-cost") config.buildCost = std::atoi(value);
+        else if (arg == "--log") logTarget = value;
+        else if (arg == "--log-level") {
+            if (!EventSink::tryParseVerbosity(value, logVerbosity)) {
+                std::cerr << "Unknown log level " << value << "\n";
+                return 1;
+            }
+        }
+        else if (arg == "--rng") {
+            if (!Rng::tryParseEngine(value, config.engine)) {
+                std::cerr << "Unknown random engine " << value << "\n";
+                return 1;
+            }
+        }
+        else {
+            std::cerr << "Unknown option " << arg << "\n";
+            printUsage();
+            return 1;
+        }
+    }
+
+    if (config.playerCount < 1 || config.boardRadius < 1 || config.buildCost < 1) {
+        std::cerr << "Players, radius and build cost must be positive.\n";
+        return 1;
+    }
+
+    // Gameplay events go nowhere unless a log is requested, so plain runs pay nothing for them
+    std::ofstream logFile;
+    std::ostream* log = nullptr;
+    if (!logTarget.empty() && logVerbosity != EventVerbosity::Off) {
+        if (logTarget == "-") {
+            log = &std::cout;
+        } else {
+            logFile.open(logTarget);
+            if (!logFile.is_open()) {
+                std::cerr << "Could not open log file " << logTarget << "\n";
+                return 1;
+            }
+            log = &logFile;
+        }
+    }
+
+    std::size_t taskCount = (gameCount + GAMES_PER_TASK - 1) / GAMES_PER_TASK;
+    std::vector<SimStats> partials(taskCount);
+    std::vector<std::string> taskLogs(log ? taskCount : 0);
+
+    auto start = std::chrono::steady_clock::now();
+    std::size_t workers = 0;
+    {
+        ThreadPool pool(threadCount);
+        workers = pool.size();
+        for (std::size_t task = 0; task < taskCount; ++task) {
+            pool.submit([&, task] {
+                std::size_t first = task * GAMES_PER_TASK;
+                std::size_t last = std::min(first + GAMES_PER_TASK, gameCount);
+                std::ostringstream taskLog;
+                for (std::size_t game = first; game < last; ++game) {
+                    std::uint64_t seed = gameSeed(baseSeed, game);
+                    SelfPlayGame selfPlay(config, seed);
+                    if (log) {
+                        taskLog << "=== Game " << game << " (seed " << seed << ") ===\n";
+                        selfPlay.getEvents().subscribeStream(taskLog, logVerbosity);
+                    }
+                    partials[task].add(selfPlay.play());
+                }
+                if (log)
+                    taskLogs[task] = taskLog.str();
+            });
+        }
+        pool.wait();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    SimStats total;
+    for (const auto& partial : partials)
+        total.merge(partial);
+
+    // Like the statistics, logs are buffered per task and written in game order
+    for (const auto& taskLog : taskLogs)
+        *log << taskLog;
+
+    std::cout << "Played " << total.gameCount() << " games (" << Rng::engineName(config.engine)
+              << ", seed " << baseSeed << ") on " << workers << " threads in "
+              << seconds << " s (" << total.gameCount() / std::max(seconds, 1e-9) << " games/s)\n";
+    total.print(std::cout);
+    return 0;
+}
@@ -22,6 +22,12 @@ struct GameConfig {
     std::vector<std::string> playerNames;               /**< Names of all players. */
     std::vector<std::string> companyNames;              /**< Names of companies linked to players. */
     std::vector<std::string> companySymbols;            /**< Company symbols or abbreviations. */
+    std::string rngEngine = "mt19937";                  /**< Random engine name (see Rng::tryParseEngine). */
+    bool fixedSeed = false;                             /**< True to start every game from the same seed. */
+    std::uint64_t seed = 0;                             /**< Seed used when fixedSeed is set. */
+    std::string consoleLogLevel = "detail";             /**< Event detail shown in the console (see EventSink::tryParseVerbosity). */
+    std::string logTarget;                              /**< File gameplay events are also written to; "-" for stdout, empty for none. */
+    std::string logLevel = "summary";                   /**< Event detail written to logTarget. */
 };
 
 /**
@@ -49,6 +55,18 @@ void saveConfig(const GameConfig& cfg) {
         file << cfg.companySymbols[i] << '\n';
     }
 
+    file << "rng " << cfg.rngEngine << '\n';
+    if (cfg.fixedSeed) {
+        file << "seed " << cfg.seed << '\n';
+    }
+    if (cfg.consoleLogLevel != "detail") {
+        file << "console_log " << cfg.consoleLogLevel << '\n';
+    }
+    if (!cfg.logTarget.empty()) {
+        file << "log " << cfg.logTarget << '\n';
+        file << "log_level " << cfg.logLevel << '\n';
+    }
+
     std::cout << "Saved config to: " << configFile << "\n";
 }
 
@@ -82,6 +100,23 @@ GameConfig loadConfig() {
         std::getline(file, cfg.companySymbols[i]);
     }
 
+    // Optional "key value" lines follow the players; older files simply end here
+    std::string key;
+    while (file >> key) {
+        if (key == "rng") {
+            file >> cfg.rngEngine;
+        } else if (key == "seed" && file >> cfg.seed) {
+            cfg.fixedSeed = true;
+        } else if (key == "console_log") {
+            file >> cfg.consoleLogLevel;
+        } else if (key == "log") {
+            // The rest of the line, so paths may contain spaces
+            std::getline(file >> std::ws, cfg.logTarget);
+        } else if (key == "log_level") {
+            file >> cfg.logLevel;
+        }
+    }
+
     return cfg;
 }
 
@@ -185,12 +220,71 @@ int StartupMenu::StartMenuLoop() {
         companies.emplace_back(cfg.companyNames[i], cfg.companySymbols[i]);
     }
 
+    // Declared before the game so it outlives the game's event subscription
+    std::ofstream logFile;
+
     Game game(radius, companies);
+    if (hasFrameLimitOverride)
+        game.setFrameLimit(frameLimitOverride);
     for (int i = 0; i < cfg.playerCount; ++i) {
         game.addPlayer(cfg.playerNames[i], &companies[i]);
     }
+
+    RngEngine engine = RngEngine::Mt19937;
+    if (hasEngineOverride) {
+        engine = engineOverride;
+    } else if (!Rng::tryParseEngine(cfg.rngEngine, engine)) {
+        std::cerr << "Unknown random engine '" << cfg.rngEngine << "'. Using mt19937.\n";
+    }
+    game.setRngEngine(engine);
+
+    if (hasSeedOverride) {
+        game.setSeed(seedOverride);
+    } else if (cfg.fixedSeed) {
+        game.setSeed(cfg.seed);
+    }
+    std::cout << "Random engine: " << Rng::engineName(game.getRng().getEngine())
+              << ", seed: " << game.getRng().getSeed() << "\n";
+
+    EventVerbosity consoleVerbosity = EventVerbosity::Detail;
+    if (!EventSink::tryParseVerbosity(cfg.consoleLogLevel, consoleVerbosity)) {
+        std::cerr << "Unknown console_log level '" << cfg.consoleLogLevel << "'. Using detail.\n";
+    }
+    game.setEventVerbosity(consoleVerbosity);
+
+    EventVerbosity logVerbosity = EventVerbosity::Summary;
+    if (!EventSink::tryParseVerbosity(cfg.logLevel, logVerbosity)) {
+        std::cerr << "Unknown log_level '" << cfg.logLevel << "'. Using summary.\n";
+    }
+    if (!cfg.logTarget.empty() && logVerbosity != EventVerbosity::Off) {
+        if (cfg.logTarget == "-") {
+            game.getEvents().subscribeStream(std::cout, logVerbosity);
+        } else {
+            logFile.open(cfg.logTarget, std::ios::app);
+            if (logFile.is_open())
+                game.getEvents().subscribeStream(logFile, logVerbosity);
+            else
+                std::cerr << "Could not open log file " << cfg.logTarget << ". Event log disabled.\n";
+        }
+    }
+
     game.setup();
     game.mainLoop();
 
     return 0;
-}
\ No newline at end of file
+}
+
+void StartupMenu::setEngineOverride(RngEngine engine) {
+    engineOverride = engine;
+    hasEngineOverride = true;
+}
+
+void StartupMenu::setSeedOverride(std::uint64_t seed) {
+    seedOverride = seed;
+    hasSeedOverride = true;
+}
+
+void StartupMenu::setFrameLimitOverride(unsigned int limit) {
+    frameLimitOverride = limit;
+    hasFrameLimitOverride = true;
+}
@@ -0,0 +1,90 @@
+#include "TextBatch.hpp"
+#include <algorithm>
+
+TextBatch::TextBatch(const sf::Font& f, unsigned int size)
+    : font(f), characterSize(size)
+{}
+
+/**
+ * @details
+ * Follows sf::Text's layout: the baseline sits characterSize pixels below the top,
+ * glyphs advance with kerning applied, and whitespace produces no vertices.
+ * Coordinates are then shifted by half the laid-out size, as Renderer used to do
+ * with setOrigin(bounds.width / 2, bounds.height / 2).
+ */
+void TextBatch::layout(const std::string& text, const sf::Color& color, std::vector<sf::Vertex>& out) const {
+    out.clear();
+
+    float x = 0.f;
+    const float y = static_cast<float>(characterSize);
+    float minX = 0.f, minY = 0.f, maxX = 0.f, maxY = 0.f;
+    bool first = true;
+    sf::Uint32 previous = 0;
+
+    for (unsigned char c : text) {
+        const sf::Uint32 current = c;
+        x += font.getKerning(previous, current, characterSize);
+        previous = current;
+
+        const sf::Glyph& glyph = font.getGlyph(current, characterSize, false);
+        if (current != ' ' && current != '\t') {
+            const float left = x + glyph.bounds.left;
+            const float top = y + glyph.bounds.top;
+            const float right = left + glyph.bounds.width;
+            const float bottom = top + glyph.bounds.height;
+
+            const float u1 = static_cast<float>(glyph.textureRect.left);
+            const float v1 = static_cast<float>(glyph.textureRect.top);
+            const float u2 = u1 + static_cast<float>(glyph.textureRect.width);
+            const float v2 = v1 + static_cast<float>(glyph.textureRect.height);
+
+            out.emplace_back(sf::Vector2f(left, top), color, sf::Vector2f(u1, v1));
+            out.emplace_back(sf::Vector2f(right, top), color, sf::Vector2f(u2, v1));
+            out.emplace_back(sf::Vector2f(left, bottom), color, sf::Vector2f(u1, v2));
+            out.emplace_back(sf::Vector2f(left, bottom), color, sf::Vector2f(u1, v2));
+            out.emplace_back(sf::Vector2f(right, top), color, sf::Vector2f(u2, v1));
+            out.emplace_back(sf::Vector2f(right, bottom), color, sf::Vector2f(u2, v2));
+
+            if (first) {
+                minX = left; minY = top; maxX = right; maxY = bottom;
+                first = false;
+            } else {
+                minX = std::min(minX, left); minY = std::min(minY, top);
+                maxX = std::max(maxX, right); maxY = std::max(maxY, bottom);
+            }
+        }
+        x += glyph.advance;
+    }
+
+    const sf::Vector2f origin((maxX - minX) / 2.f, (maxY - minY) / 2.f);
+    for (sf::Vertex& vertex : out)
+        vertex.position -= origin;
+}
+
+void TextBatch::append(const std::vector<sf::Vertex>& glyphs, const sf::Vector2f& center) {
+    for (const sf::Vertex& glyph : glyphs) {
+        vertices.push_back(glyph);
+        vertices.back().position += center;
+    }
+}
+
+void TextBatch::add(const std::string& text, const sf::Vector2f& center, const sf::Color& color) {
+    layout(text, color, scratch);
+    append(scratch, center);
+}
+
+void TextBatch::clear() {
+    vertices.clear();
+}
+
+void TextBatch::drawRange(sf::RenderTarget& target, std::size_t first, std::size_t count,
+                          sf::RenderStates states) const {
+    if (count == 0)
+        return;
+    states.texture = &font.getTexture(characterSize);
+    target.draw(vertices.data() + first, count, sf::Triangles, states);
+}
+
+void TextBatch::draw(sf::RenderTarget& target, sf::RenderStates states) const {
+    drawRange(target, 0, vertices.size(), states);
+}
@@ -0,0 +1,113 @@
+#include "ThreadPool.hpp"
+#include <algorithm>
+
+namespace {
+    // Identifies the current thread's worker slot so nested submits stay local.
+    thread_local const ThreadPool* currentPool = nullptr;
+    thread_local std::size_t currentWorker = 0;
+}
+
+ThreadPool::ThreadPool(std::size_t threadCount) {
+    if (threadCount == 0)
+        threadCount = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+
+    queues.reserve(threadCount);
+    for (std::size_t i = 0; i < threadCount; ++i)
+        queues.push_back(std::make_unique<WorkerQueue>());
+
+    workers.reserve(threadCount);
+    for (std::size_t i = 0; i < threadCount; ++i)
+        workers.emplace_back(&ThreadPool::workerLoop, this, i);
+}
+
+ThreadPool::~ThreadPool() {
+    wait();
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        stopping = true;
+    }
+    workAvailable.notify_all();
+    for (auto& worker : workers)
+        worker.join();
+}
+
+void ThreadPool::submit(std::function<void()> task) {
+    std::size_t target = (currentPool == this)
+        ? currentWorker
+        : nextQueue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+
+    {
+        // Count before publishing: once the task is queued any worker may steal and finish
+        // it, and its decrements must never run ahead of this increment. Counting under the
+        // state lock also ensures a sleeping worker cannot miss the wakeup.
+        std::lock_guard<std::mutex> lock(stateMutex);
+        ++pending;
+        queued.fetch_add(1, std::memory_order_relaxed);
+    }
+    try {
+        std::lock_guard<std::mutex> lock(queues[target]->mutex);
+        queues[target]->tasks.push_back(std::move(task));
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        queued.fetch_sub(1, std::memory_order_relaxed);
+        if (--pending == 0)
+            allDone.notify_all();
+        throw;
+    }
+    workAvailable.notify_one();
+}
+
+void ThreadPool::wait() {
+    std::unique_lock<std::mutex> lock(stateMutex);
+    allDone.wait(lock, [this] { return pending == 0; });
+}
+
+// Own queue is used LIFO for locality; victims are robbed FIFO so the oldest,
+// typically largest, chunks of work migrate.
+bool ThreadPool::tryTake(std::size_t index, std::function<void()>& task) {
+    {
+        WorkerQueue& own = *queues[index];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            return true;
+        }
+    }
+
+    for (std::size_t offset = 1; offset < queues.size(); ++offset) {
+        WorkerQueue& victim = *queues[(index + offset) % queues.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::workerLoop(std::size_t index) {
+    currentPool = this;
+    currentWorker = index;
+
+    while (true) {
+        std::function<void()> task;
+        if (tryTake(index, task)) {
+            queued.fetch_sub(1, std::memory_order_relaxed);
+            task();
+
+            std::lock_guard<std::mutex> lock(stateMutex);
+            if (--pending == 0)
+                allDone.notify_all();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(stateMutex);
+        workAvailable.wait(lock, [this] {
+            return stopping || queued.load(std::memory_order_relaxed) > 0;
+        });
+        if (stopping && queued.load(std::memory_order_relaxed) == 0)
+            return;
+    }
+}
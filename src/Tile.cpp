@@ -1,8 +1,9 @@
 #include "Tile.hpp"
+#include "Colors.hpp"
 #include <iostream>
 
 // Default constructor: no owner, neutral color.
-Tile::Tile() : owner(nullptr), color("neutral") {}
+Tile::Tile() : owner(nullptr), color(ColorId::Neutral) {}
 
 Company* Tile::getOwner() const {
     return owner;
@@ -12,11 +13,11 @@ void Tile::setOwner(Company* newOwner) {
     owner = newOwner;
 }
 
-const std::string& Tile::getColor() const {
+ColorId Tile::getColor() const {
     return color;
 }
 
-void Tile::setColor(const std::string& newColor) {
+void Tile::setColor(ColorId newColor) {
     color = newColor;
 }
 
@@ -24,7 +25,7 @@ void Tile::setColor(const std::string& newColor) {
 void Tile::printInfo() const {
     if (owner)
         std::cout << "Tile owned by " << owner->getName()
-                  << " (" << color << ")\n";
+                  << " (" << Colors::toString(color) << ")\n";
     else
-        std::cout << "Unowned tile (" << color << ")\n";
+        std::cout << "Unowned tile (" << Colors::toString(color) << ")\n";
 }
@@ -0,0 +1,88 @@
+#include "TriggerBatch.hpp"
+#include <algorithm>
+
+void ResourceDelta::add(ResourceId type, int amount) {
+    if (Resources::isKnown(type)) {
+        known[static_cast<std::size_t>(type)] += amount;
+        return;
+    }
+
+    auto it = std::find_if(extra.begin(), extra.end(),
+                           [&](const std::pair<ResourceId, int>& e) { return e.first == type; });
+    if (it != extra.end())
+        it->second += amount;
+    else
+        extra.emplace_back(type, amount);
+}
+
+bool ResourceDelta::empty() const {
+    for (int amount : known) {
+        if (amount != 0)
+            return false;
+    }
+    return std::all_of(extra.begin(), extra.end(),
+                       [](const std::pair<ResourceId, int>& e) { return e.second == 0; });
+}
+
+void ResourceDelta::clear() {
+    known.fill(0);
+    extra.clear();
+}
+
+TriggerBatch::TriggerBatch(CardTrigger trigger_) : trigger(trigger_) {}
+
+void TriggerBatch::subscribe(std::size_t playerIndex, const CardDefinition& definition) {
+    if (!definition.hasTrigger(trigger))
+        return;
+
+    auto [it, inserted] = positions.try_emplace(keyOf(playerIndex, definition.id), subscriptions.size());
+    if (inserted)
+        subscriptions.push_back({&definition, static_cast<std::uint32_t>(playerIndex), 1});
+    else
+        ++subscriptions[it->second].copies;
+}
+
+void TriggerBatch::unsubscribeAll(std::size_t playerIndex, CardId id) {
+    auto it = positions.find(keyOf(playerIndex, id));
+    if (it == positions.end())
+        return;
+
+    // Swap the last entry into the freed slot and repoint its index
+    std::size_t position = it->second;
+    positions.erase(it);
+    if (position != subscriptions.size() - 1) {
+        subscriptions[position] = subscriptions.back();
+        const Subscription& moved = subscriptions[position];
+        positions[keyOf(moved.playerIndex, moved.definition->id)] = position;
+    }
+    subscriptions.pop_back();
+}
+
+void TriggerBatch::clear() {
+    subscriptions.clear();
+    positions.clear();
+}
+
+/**
+ * @details
+ * Every current CardOp is additive, so N copies of a card contribute N times its
+ * amounts and the order in which cards fire does not matter.
+ */
+void TriggerBatch::collect(std::vector<ResourceDelta>& deltas) const {
+    for (auto& delta : deltas)
+        delta.clear();
+
+    for (const Subscription& sub : subscriptions) {
+        ResourceDelta& delta = deltas[sub.playerIndex];
+        const int copies = static_cast<int>(sub.copies);
+
+        for (const CardInstruction* op = sub.definition->triggerBegin(trigger);
+             op != sub.definition->triggerEnd(trigger); ++op) {
+            switch (op->op) {
+            case CardOp::AddResource:
+                delta.add(op->resource, op->amount * copies);
+                break;
+            }
+        }
+    }
+}
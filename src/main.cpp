@@ -3,11 +3,35 @@
 #include "Renderer.hpp"
 #include "StartupMenu.hpp"
 #include <SFML/Graphics.hpp>
+#include <cstdlib>
+#include <iostream>
+#include <string>
 #include <vector>
 
-int main() {
+int main(int argc, char** argv) {
     StartupMenu initialStartupMenu;
+
+    // Optional --seed and --rng options make a session reproducible; --fps caps the frame rate
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string arg = argv[i];
+        if (arg == "--seed") {
+            initialStartupMenu.setSeedOverride(std::strtoull(argv[i + 1], nullptr, 10));
+        } else if (arg == "--rng") {
+            RngEngine engine;
+            if (!Rng::tryParseEngine(argv[i + 1], engine)) {
+                std::cerr << "Unknown random engine " << argv[i + 1] << "\n";
+                return 1;
+            }
+            initialStartupMenu.setEngineOverride(engine);
+        } else if (arg == "--fps") {
+            initialStartupMenu.setFrameLimitOverride(static_cast<unsigned int>(std::strtoul(argv[i + 1], nullptr, 10)));
+        } else {
+            std::cerr << "Unknown option " << arg << "\n";
+            return 1;
+        }
+    }
+
     initialStartupMenu.StartMenuLoop();
 
     return 0;
-}
\ No newline at end of file
+}
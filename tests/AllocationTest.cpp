@@ -0,0 +1,108 @@
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include "CardCatalog.hpp"
+#include "Player.hpp"
+#include "Rng.hpp"
+
+// Full draw/play/return passes over the whole pool
+constexpr int TRANSFER_CYCLES = 1000;
+
+// Times the draw pile is emptied into the discard pile and refilled from it
+constexpr int REFILL_CYCLES = 100000;
+
+// Every global heap allocation in the process, counted by the replacement operator new below
+static std::size_t allocationCount = 0;
+
+void* operator new(std::size_t size) {
+    ++allocationCount;
+    if (void* memory = std::malloc(size ? size : 1))
+        return memory;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+/**
+ * @brief Runs fn and checks that it made no heap allocations.
+ * @return True if none were made; otherwise prints the count and returns false.
+ */
+template <typename Fn>
+static bool expectNoAllocations(const char* what, Fn&& fn) {
+    std::size_t before = allocationCount;
+    fn();
+    std::size_t made = allocationCount - before;
+    if (made != 0) {
+        std::cerr << "FAIL: " << what << " made " << made << " heap allocations\n";
+        return false;
+    }
+    std::cout << "ok: " << what << "\n";
+    return true;
+}
+
+/**
+ * @brief Checks that moving cards between decks, hands and play areas never allocates.
+ *
+ * Uses the real card pool, so the zones must hold more cards than any fixed guess
+ * (self-play alone puts 20 copies of Daily Funding into play). Also cycles the pool
+ * through the discard pile, drawing lazily from each refill as GameEngine does.
+ */
+int main() {
+    auto catalog = CardCatalog::get("cards.json");
+    if (catalog->size() == 0) {
+        std::cerr << "FAIL: could not load cards.json\n";
+        return 1;
+    }
+
+    Deck deck("drawDeck");
+    catalog->fillDeck(deck);
+    Player player("Tester", nullptr);
+    catalog->reserveZone(player.heldCards);
+    catalog->reserveZone(player.playedCards);
+
+    bool passed = expectNoAllocations("take/receive/play/return cycles", [&] {
+        for (int cycle = 0; cycle < TRANSFER_CYCLES; ++cycle) {
+            while (!deck.empty())
+                player.receive(deck.take());
+            while (!player.heldCards.empty())
+                player.playFromHand(player.heldCards.back().getId());
+
+            Card card;
+            while (!player.playedCards.empty()) {
+                player.playedCards.take(player.playedCards.back().getId(), card);
+                deck.put(std::move(card));
+            }
+        }
+    });
+
+    if (deck.size() != catalog->size()) {
+        std::cerr << "FAIL: deck holds " << deck.size() << " cards after cycling, expected "
+                  << catalog->size() << "\n";
+        passed = false;
+    }
+
+    Deck discard("discardDeck");
+    discard.cards.reserve(catalog->size());
+    Rng rng(RngEngine::Xoshiro256, 1);
+    bool refillPassed = expectNoAllocations("draw/discard/refill cycles", [&] {
+        for (int cycle = 0; cycle < REFILL_CYCLES; ++cycle) {
+            while (!deck.empty())
+                discard.put(deck.draw(rng));
+            deck.refillFrom(discard);
+        }
+    });
+    passed = passed && refillPassed;
+
+    if (deck.size() != catalog->size() || !discard.empty()) {
+        std::cerr << "FAIL: refilling lost cards: " << deck.size() << " in deck, "
+                  << discard.size() << " in discard\n";
+        passed = false;
+    }
+    return passed ? 0 : 1;
+}
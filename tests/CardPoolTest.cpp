@@ -0,0 +1,118 @@
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "CardDatabase.hpp"
+#include "CardZone.hpp"
+#include "Deck.hpp"
+
+// More definitions than a 16-bit CardId can number
+constexpr std::size_t DEFINITION_COUNT = 70000;
+
+// Copies of each definition in the generated pool
+constexpr int COPIES = 2;
+
+/** @brief Name of the i-th generated card. */
+static std::string cardName(std::size_t i) {
+    return "C" + std::to_string(i);
+}
+
+/** @brief Writes a card file with DEFINITION_COUNT distinct definitions. */
+static bool writePool(const std::filesystem::path& path) {
+    std::ofstream out(path);
+    out << "[\n";
+    for (std::size_t i = 0; i < DEFINITION_COUNT; ++i) {
+        out << (i ? ",\n" : "") << "  {\"name\": \"" << cardName(i) << "\", \"description\": \"Card " << i
+            << "\", \"copies\": " << COPIES << ", \"triggers\": {\"onPlay\": [{\"action\": \"addResource\", "
+            << "\"type\": \"funds\", \"amount\": " << (i % 7) << "}]}}";
+    }
+    out << "\n]\n";
+    return static_cast<bool>(out);
+}
+
+/**
+ * @brief Checks that every definition resolves to itself by name and by id.
+ * @return True if the registry and deck match the generated pool.
+ */
+static bool checkPool(const char* loader, const CardRegistry& registry, const Deck& deck) {
+    if (registry.size() != DEFINITION_COUNT || deck.size() != DEFINITION_COUNT * COPIES) {
+        std::cerr << "FAIL: " << loader << " loaded " << registry.size() << " definitions and "
+                  << deck.size() << " cards\n";
+        return false;
+    }
+
+    for (std::size_t i = 0; i < DEFINITION_COUNT; ++i) {
+        const std::string name = cardName(i);
+        const CardDefinition* byName = registry.find(name);
+        if (!byName || byName->name != name || registry.get(byName->id).name != name ||
+            byName->code.size() != 1 || byName->code[0].amount != static_cast<int>(i % 7)) {
+            std::cerr << "FAIL: " << loader << " does not round-trip " << name << "\n";
+            return false;
+        }
+    }
+
+    for (const Card& card : deck.cards) {
+        if (&registry.get(card.getId()) != card.getDefinition()) {
+            std::cerr << "FAIL: " << loader << " deck card " << card.getName() << " has a stale id\n";
+            return false;
+        }
+    }
+    std::cout << "ok: " << loader << " round-trips " << DEFINITION_COUNT << " definitions\n";
+    return true;
+}
+
+/**
+ * @brief Loads a pool too large for 16-bit card ids through both card loaders.
+ *
+ * Ids past 65535 must neither wrap nor alias earlier cards, in the registry or in
+ * the per-id indices of a CardZone.
+ */
+int main() {
+    const std::filesystem::path dir = std::filesystem::temp_directory_path();
+    const std::filesystem::path jsonPath = dir / "spotlight_card_pool_test.json";
+    const std::filesystem::path dbPath = dir / "spotlight_card_pool_test.bin";
+    if (!writePool(jsonPath)) {
+        std::cerr << "FAIL: could not write " << jsonPath << "\n";
+        return 1;
+    }
+
+    bool passed = true;
+
+    CardRegistry jsonRegistry;
+    Deck jsonDeck;
+    jsonDeck.loadFromJsonFile(jsonPath.string(), jsonRegistry);
+    passed = checkPool("JSON loader", jsonRegistry, jsonDeck) && passed;
+
+    std::string error;
+    CardRegistry dbRegistry;
+    std::vector<CardDatabase::Entry> entries;
+    if (!CardDatabase::compile(jsonPath, dbPath, error) ||
+        !CardDatabase::load(dbPath, jsonPath, dbRegistry, entries)) {
+        std::cerr << "FAIL: binary card database: " << (error.empty() ? "load rejected" : error) << "\n";
+        passed = false;
+    } else {
+        Deck dbDeck;
+        for (const CardDatabase::Entry& entry : entries) {
+            for (int i = 0; i < entry.copies; ++i)
+                dbDeck.put(dbRegistry.makeInstance(*entry.definition));
+        }
+        passed = checkPool("binary loader", dbRegistry, dbDeck) && passed;
+    }
+
+    // The first and the last definition must occupy separate per-id slots
+    CardZone zone;
+    const CardDefinition* first = jsonRegistry.find(cardName(0));
+    const CardDefinition* last = jsonRegistry.find(cardName(DEFINITION_COUNT - 1));
+    if (first && last) {
+        zone.add(jsonRegistry.makeInstance(*last));
+        if (zone.count(first->id) != 0 || zone.count(last->id) != 1) {
+            std::cerr << "FAIL: card zone aliases " << last->name << " with " << first->name << "\n";
+            passed = false;
+        }
+    }
+
+    std::filesystem::remove(jsonPath);
+    std::filesystem::remove(dbPath);
+    return passed ? 0 : 1;
+}
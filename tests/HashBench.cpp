@@ -0,0 +1,118 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include "CubeCoord.hpp"
+
+// Board radii to measure, from the default board up to the largest supported ones
+constexpr int RADII[] = {3, 8, 16, 32, 64};
+
+/**
+ * @brief The hash CubeCoordHash replaced, kept here as the baseline.
+ *
+ * With an identity std::hash<int>, mirror-image coordinates collide.
+ */
+struct LegacyCubeCoordHash {
+    std::size_t operator()(const CubeCoord& c) const noexcept {
+        std::size_t h1 = std::hash<int>{}(c.x);
+        std::size_t h2 = std::hash<int>{}(c.y);
+        std::size_t h3 = std::hash<int>{}(c.z);
+        return h1 ^ (h2 << 1) ^ (h3 << 2);
+    }
+};
+
+/** @brief Returns every coordinate of a hex board of the given radius. */
+static std::vector<CubeCoord> hexBoard(int radius) {
+    std::vector<CubeCoord> coords;
+    for (int x = -radius; x <= radius; ++x) {
+        for (int y = std::max(-radius, -x - radius); y <= std::min(radius, -x + radius); ++y)
+            coords.emplace_back(x, y, -x - y);
+    }
+    return coords;
+}
+
+/** @brief Bucket load and lookup latency of one hash over one board. */
+struct HashResult {
+    std::size_t bucketCount = 0;
+    std::size_t usedBuckets = 0;
+    std::size_t maxBucket = 0;
+    double meanChain = 0.0;     ///< Average bucket size seen by a successful lookup.
+    double lookupNs = 0.0;
+};
+
+/**
+ * @brief Fills an unordered_set with a board and times finding every tile.
+ * @param coords Tiles to insert.
+ * @param order The same tiles in the order to look them up.
+ * @param passes Number of times to look up every tile.
+ */
+template <typename Hash>
+static HashResult measure(const std::vector<CubeCoord>& coords, const std::vector<CubeCoord>& order, int passes) {
+    std::unordered_set<CubeCoord, Hash> set(coords.begin(), coords.end());
+
+    HashResult result;
+    result.bucketCount = set.bucket_count();
+    std::size_t squaredSizes = 0;
+    for (std::size_t b = 0; b < set.bucket_count(); ++b) {
+        std::size_t size = set.bucket_size(b);
+        if (size != 0)
+            ++result.usedBuckets;
+        result.maxBucket = std::max(result.maxBucket, size);
+        squaredSizes += size * size;
+    }
+    result.meanChain = static_cast<double>(squaredSizes) / static_cast<double>(coords.size());
+
+    std::size_t found = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < passes; ++pass) {
+        for (const CubeCoord& coord : order)
+            found += set.count(coord);
+    }
+    auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start);
+    result.lookupNs = elapsed.count() / static_cast<double>(found);
+    return result;
+}
+
+/**
+ * @brief Compares the old and new CubeCoordHash on full hex boards.
+ *
+ * Reports bucket usage, the longest bucket, the mean chain a lookup walks and the
+ * average lookup time. Build with optimizations for meaningful timings.
+ */
+int main(int argc, char** argv) {
+    int passes = 50;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--passes" && i + 1 < argc) {
+            passes = std::max(1, std::atoi(argv[++i]));
+        } else {
+            std::cout << "Usage: spotlight_bench_hash [--passes N]\n";
+            return arg == "--help" || arg == "-h" ? 0 : 1;
+        }
+    }
+
+    std::cout << "hash    radius  tiles  buckets   used  max  chain  lookup ns\n";
+    std::cout << std::fixed;
+    std::mt19937 shuffler(1);
+    for (int radius : RADII) {
+        std::vector<CubeCoord> coords = hexBoard(radius);
+        std::vector<CubeCoord> order = coords;
+        std::shuffle(order.begin(), order.end(), shuffler);
+
+        auto report = [&](const char* name, const HashResult& r) {
+            std::cout << std::left << std::setw(8) << name << std::right
+                      << std::setw(6) << radius << std::setw(7) << coords.size()
+                      << std::setw(9) << r.bucketCount << std::setw(7) << r.usedBuckets
+                      << std::setw(5) << r.maxBucket << std::setw(7) << std::setprecision(2) << r.meanChain
+                      << std::setw(11) << std::setprecision(1) << r.lookupNs << "\n";
+        };
+        report("old", measure<LegacyCubeCoordHash>(coords, order, passes));
+        report("new", measure<CubeCoordHash>(coords, order, passes));
+    }
+    return 0;
+}